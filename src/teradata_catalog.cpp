@@ -24,6 +24,8 @@ TeradataCatalog::TeradataCatalog(AttachedDatabase &db, const string &logon_strin
 }
 
 TeradataCatalog::~TeradataCatalog() {
+	// Stop any background revalidation of the snapshot from reporting to this catalog
+	catalog_cache.reset();
 }
 
 void TeradataCatalog::Initialize(bool load_builtin) {
@@ -33,6 +35,126 @@ TeradataConnection &TeradataCatalog::GetConnection() const {
 	return *conn;
 }
 
+unique_ptr<TeradataConnection> TeradataCatalog::OpenConnection() const {
+	return OpenConnection(buffer_size);
+}
+
+unique_ptr<TeradataConnection> TeradataCatalog::OpenConnection(idx_t response_buffer_size) const {
+	auto result = make_uniq<TeradataConnection>(path, response_buffer_size);
+	result->Execute("DATABASE " + KeywordHelper::WriteOptionallyQuoted(default_schema) + ";");
+	return result;
+}
+
+// Metadata results are small, so the metadata session does not need a large response buffer
+static constexpr idx_t METADATA_BUFFER_SIZE = 64 * 1024;
+
+TeradataConnection &TeradataCatalog::GetMetadataConnection() const {
+	lock_guard<mutex> guard(metadata_lock);
+	if (!metadata_conn) {
+		metadata_conn = OpenConnection(MinValue<idx_t>(buffer_size, METADATA_BUFFER_SIZE));
+	}
+	return *metadata_conn;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Prepared Queries
+//----------------------------------------------------------------------------------------------------------------------
+// Keep the cache from growing indefinitely with ad-hoc queries
+static constexpr idx_t MAX_PREPARED_QUERIES = 1024;
+
+// Collapse whitespace outside of quotes, so that queries only differing in formatting share a cache entry
+static string NormalizeQuery(const string &sql) {
+	string result;
+	char quote = '\0';
+	for (auto c : sql) {
+		if (quote) {
+			if (c == quote) {
+				quote = '\0';
+			}
+		} else if (c == '\'' || c == '"') {
+			quote = c;
+		} else if (StringUtil::CharacterIsSpace(c)) {
+			if (!result.empty() && result.back() != ' ') {
+				result += ' ';
+			}
+			continue;
+		}
+		result += c;
+	}
+	if (!result.empty() && result.back() == ' ') {
+		result.pop_back();
+	}
+	return result;
+}
+
+void TeradataCatalog::Prepare(TeradataConnection &con, const string &sql, vector<TeradataType> &types,
+                              vector<string> &names) {
+	const auto key = NormalizeQuery(sql);
+	{
+		lock_guard<mutex> guard(prepared_lock);
+		const auto entry = prepared.find(key);
+		if (entry != prepared.end()) {
+			types = entry->second.types;
+			names = entry->second.names;
+			return;
+		}
+	}
+
+	con.Prepare(sql, types, names);
+
+	lock_guard<mutex> guard(prepared_lock);
+	if (prepared.size() >= MAX_PREPARED_QUERIES) {
+		prepared.clear();
+	}
+	prepared[key] = PreparedInfo {types, names};
+}
+
+void TeradataCatalog::EvictPrepared(const string &sql) {
+	lock_guard<mutex> guard(prepared_lock);
+	prepared.erase(NormalizeQuery(sql));
+}
+
+void TeradataCatalog::ClearPrepared() {
+	lock_guard<mutex> guard(prepared_lock);
+	prepared.clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Catalog Cache
+//----------------------------------------------------------------------------------------------------------------------
+void TeradataCatalog::SetCatalogCache(unique_ptr<TeradataCatalogCache> cache) {
+	catalog_cache = std::move(cache);
+	catalog_cache->Load();
+	catalog_cache->StartRevalidation(*this);
+}
+
+void TeradataCatalog::RefreshChangedSchemas(ClientContext &context) {
+	if (!catalog_cache) {
+		return;
+	}
+	// The catalog may have been populated from the snapshot before its revalidation found it to be outdated
+	for (auto &schema_name : catalog_cache->TakeChangedSchemas()) {
+		const auto entry = schemas.GetEntry(context, schema_name);
+		if (entry) {
+			entry->Cast<TeradataSchemaEntry>().Refresh(context);
+		}
+	}
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Locking
+//----------------------------------------------------------------------------------------------------------------------
+bool TeradataCatalog::UseAccessLock(ClientContext &context) const {
+	if (access_lock) {
+		return true;
+	}
+	Value access_lock_value;
+	if (context.TryGetCurrentSetting("teradata_access_lock", access_lock_value)) {
+		return access_lock_value.GetValue<bool>();
+	}
+	return false;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // Schema Management
 //----------------------------------------------------------------------------------------------------------------------
@@ -42,6 +164,8 @@ optional_ptr<CatalogEntry> TeradataCatalog::CreateSchema(CatalogTransaction tran
 }
 
 void TeradataCatalog::ScanSchemas(ClientContext &context, std::function<void(SchemaCatalogEntry &)> callback) {
+	RefreshChangedSchemas(context);
+
 	// Ok return a schema, with entries
 	schemas.Scan(context, [&](CatalogEntry &schema) { callback(schema.Cast<TeradataSchemaEntry>()); });
 }
@@ -54,6 +178,7 @@ optional_ptr<SchemaCatalogEntry> TeradataCatalog::LookupSchema(CatalogTransactio
 		schema_name = default_schema;
 	}
 
+	RefreshChangedSchemas(transaction.GetContext());
 	auto entry = schemas.GetEntry(transaction.GetContext(), schema_name);
 	if (!entry && if_not_found != OnEntryNotFound::RETURN_NULL) {
 		throw BinderException("Schema \"%s\" not found", schema_name);
@@ -67,6 +192,20 @@ void TeradataCatalog::DropSchema(ClientContext &context, DropInfo &info) {
 
 void TeradataCatalog::ClearCache() {
 	schemas.ClearEntries();
+
+	// Reload from Teradata instead of the local snapshot, which is then rewritten
+	if (catalog_cache) {
+		catalog_cache->Clear();
+	}
+
+	ClearPrepared();
+}
+
+void TeradataCatalog::RefreshCache(ClientContext &context) {
+	schemas.Scan(context, [&](CatalogEntry &schema) { schema.Cast<TeradataSchemaEntry>().Refresh(context); });
+
+	// The result types of prepared queries may have changed along with the tables
+	ClearPrepared();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
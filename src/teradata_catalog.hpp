@@ -2,6 +2,7 @@
 #include "teradata_storage.hpp"
 #include "teradata_connection.hpp"
 #include "teradata_schema_set.hpp"
+#include "teradata_catalog_cache.hpp"
 
 namespace duckdb {
 
@@ -14,6 +15,36 @@ public:
 	// TODO: this should not be exposed like this. We should expose a pool instead?
 	TeradataConnection &GetConnection() const;
 
+	// Open a new session to the same Teradata system, e.g. to hold session local volatile tables
+	unique_ptr<TeradataConnection> OpenConnection() const;
+	unique_ptr<TeradataConnection> OpenConnection(idx_t response_buffer_size) const;
+
+	// The session used to load catalog metadata from the DBC views, separate from the session used to scan data so
+	// that binding a query never has to wait for (or interleave with) a large result being transferred.
+	TeradataConnection &GetMetadataConnection() const;
+
+	// Prepare a query, reusing the result types and names of an earlier prepare of the same query text
+	void Prepare(TeradataConnection &con, const string &sql, vector<TeradataType> &types, vector<string> &names);
+	// Forget the cached prepare result of a query, e.g. because the schema of its result has changed
+	void EvictPrepared(const string &sql);
+	// Forget the cached prepare results of all queries, e.g. after executing arbitrary (DDL) statements
+	void ClearPrepared();
+
+	// Persist the loaded tables to a local snapshot, and use the snapshot (if any) instead of loading them again
+	void SetCatalogCache(unique_ptr<TeradataCatalogCache> cache);
+	optional_ptr<TeradataCatalogCache> GetCatalogCache() const {
+		return catalog_cache.get();
+	}
+	// Refresh the schemas that the revalidation of the snapshot found to have changed in Teradata
+	void RefreshChangedSchemas(ClientContext &context);
+
+	// Whether scans read with an ACCESS lock, either because of the ACCESS_LOCK option passed to ATTACH or because of
+	// the teradata_access_lock setting
+	bool UseAccessLock(ClientContext &context) const;
+	void SetAccessLock(bool access_lock_p) {
+		access_lock = access_lock_p;
+	}
+
 public:
 	void Initialize(bool load_builtin) override;
 
@@ -45,17 +76,37 @@ public:
 	}
 
 	void ClearCache();
+	// Reload only the tables that have been created, altered or dropped in Teradata since they were loaded
+	void RefreshCache(ClientContext &context);
 
 private:
 	unique_ptr<TeradataConnection> conn;
 	string path;
 
+	// The metadata session, opened on first use
+	mutable mutex metadata_lock;
+	mutable unique_ptr<TeradataConnection> metadata_conn;
+
 	// The set of schemas in this database
 	TeradataSchemaSet schemas;
 	string default_schema;
 
 	// Teradata response buffer size
 	idx_t buffer_size;
+
+	// The result types and names of prepared queries, keyed by their normalized query text
+	struct PreparedInfo {
+		vector<TeradataType> types;
+		vector<string> names;
+	};
+	mutex prepared_lock;
+	unordered_map<string, PreparedInfo> prepared;
+
+	// The local snapshot of the catalog, if enabled
+	unique_ptr<TeradataCatalogCache> catalog_cache;
+
+	// Whether scans read with an ACCESS lock by default
+	bool access_lock = false;
 };
 
 } // namespace duckdb
\ No newline at end of file
@@ -0,0 +1,275 @@
+#include "teradata_catalog_cache.hpp"
+#include "teradata_catalog.hpp"
+#include "teradata_connection.hpp"
+#include "teradata_table_set.hpp"
+
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/common/serializer/buffered_file_reader.hpp"
+#include "duckdb/common/serializer/buffered_file_writer.hpp"
+
+namespace duckdb {
+
+// Bump the version whenever the format of the cache file changes, older files are then ignored
+static constexpr uint32_t CATALOG_CACHE_MAGIC = 0x54444343; // "TDCC"
+static constexpr uint32_t CATALOG_CACHE_VERSION = 2;
+
+TeradataCatalogCache::TeradataCatalogCache(FileSystem &fs, string path_p) : fs(fs), path(std::move(path_p)) {
+}
+
+TeradataCatalogCache::~TeradataCatalogCache() {
+	// Do not wait for a revalidation in progress, it discards its result once it sees the cache is gone
+	if (revalidation) {
+		lock_guard<mutex> guard(revalidation->lock);
+		revalidation->cache = nullptr;
+	}
+}
+
+string TeradataCatalogCache::GetCachePath(FileSystem &fs, const string &directory, const string &host,
+                                          const string &user, const string &database) {
+	// Teradata names are case insensitive, and so are host names
+	const auto key = StringUtil::Lower(host + "/" + user + "/" + database);
+	return fs.JoinPath(fs.ExpandPath(directory), "teradata_catalog_" + to_string(Hash(key.c_str())) + ".cache");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Read/Write
+//----------------------------------------------------------------------------------------------------------------------
+static void WriteString(BufferedFileWriter &writer, const string &str) {
+	writer.Write<uint32_t>(UnsafeNumericCast<uint32_t>(str.size()));
+	writer.WriteData(const_data_ptr_cast(str.data()), str.size());
+}
+
+static string ReadString(BufferedFileReader &reader) {
+	const auto size = reader.Read<uint32_t>();
+	string result(size, '\0');
+	reader.ReadData(data_ptr_cast(&result[0]), size);
+	return result;
+}
+
+void TeradataCatalogCache::Load() {
+	lock_guard<mutex> guard(lock);
+	schemas.clear();
+
+	if (!fs.FileExists(path)) {
+		return;
+	}
+
+	try {
+		BufferedFileReader reader(fs, path.c_str());
+		if (reader.Read<uint32_t>() != CATALOG_CACHE_MAGIC || reader.Read<uint32_t>() != CATALOG_CACHE_VERSION) {
+			return;
+		}
+
+		const auto schema_count = reader.Read<uint32_t>();
+		for (idx_t schema_idx = 0; schema_idx < schema_count; schema_idx++) {
+			auto schema_name = ReadString(reader);
+			const auto column_count = reader.Read<uint64_t>();
+
+			vector<TeradataCachedColumn> columns;
+			for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
+				TeradataCachedColumn column;
+				column.table_name = ReadString(reader);
+				column.column_name = ReadString(reader);
+				column.column_type = ReadString(reader);
+				column.column_length = reader.Read<int32_t>();
+				column.last_altered = ReadString(reader);
+				columns.push_back(std::move(column));
+			}
+			schemas[schema_name] = std::move(columns);
+		}
+	} catch (std::exception &ex) {
+		// The cache file is corrupt or truncated, ignore it. It is rewritten once the catalog is loaded from Teradata.
+		schemas.clear();
+	}
+}
+
+void TeradataCatalogCache::Write() {
+	// Write to a temporary file first, so that a concurrent (or crashed) writer never leaves a partial cache file
+	const auto tmp_path = path + ".tmp";
+	try {
+		const auto directory = path.substr(0, path.size() - StringUtil::GetFileName(path).size());
+		if (!directory.empty() && !fs.DirectoryExists(directory)) {
+			fs.CreateDirectory(directory);
+		}
+
+		BufferedFileWriter writer(fs, tmp_path);
+		writer.Write<uint32_t>(CATALOG_CACHE_MAGIC);
+		writer.Write<uint32_t>(CATALOG_CACHE_VERSION);
+		writer.Write<uint32_t>(UnsafeNumericCast<uint32_t>(schemas.size()));
+		for (auto &schema : schemas) {
+			WriteString(writer, schema.first);
+			writer.Write<uint64_t>(schema.second.size());
+			for (auto &column : schema.second) {
+				WriteString(writer, column.table_name);
+				WriteString(writer, column.column_name);
+				WriteString(writer, column.column_type);
+				writer.Write<int32_t>(column.column_length);
+				WriteString(writer, column.last_altered);
+			}
+		}
+		writer.Sync();
+		writer.Close();
+
+		fs.MoveFile(tmp_path, path);
+	} catch (std::exception &ex) {
+		// The cache is only an optimization, failing to write it should not fail the query that loaded the catalog
+		fs.TryRemoveFile(tmp_path);
+	}
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Snapshot
+//----------------------------------------------------------------------------------------------------------------------
+bool TeradataCatalogCache::TryGetColumns(const string &schema_name, vector<TeradataCachedColumn> &result) {
+	lock_guard<mutex> guard(lock);
+	const auto entry = schemas.find(schema_name);
+	if (entry == schemas.end()) {
+		return false;
+	}
+	result = entry->second;
+	return true;
+}
+
+bool TeradataCatalogCache::HasColumns(const string &schema_name) {
+	lock_guard<mutex> guard(lock);
+	return schemas.find(schema_name) != schemas.end();
+}
+
+void TeradataCatalogCache::SetColumns(const string &schema_name, vector<TeradataCachedColumn> columns) {
+	lock_guard<mutex> guard(lock);
+	schemas[schema_name] = std::move(columns);
+	Write();
+}
+
+void TeradataCatalogCache::Invalidate(const string &schema_name) {
+	lock_guard<mutex> guard(lock);
+	if (schemas.erase(schema_name) > 0) {
+		Write();
+	}
+}
+
+void TeradataCatalogCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	schemas.clear();
+	fs.TryRemoveFile(path);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Revalidation
+//----------------------------------------------------------------------------------------------------------------------
+void TeradataCatalogCache::StartRevalidation(TeradataCatalog &catalog) {
+	vector<string> schema_names;
+	{
+		lock_guard<mutex> guard(lock);
+		for (auto &schema : schemas) {
+			schema_names.push_back(schema.first);
+		}
+	}
+	if (schema_names.empty() || revalidation) {
+		return;
+	}
+	revalidation = make_shared_ptr<TeradataRevalidationState>();
+	revalidation->cache = this;
+
+	// The thread may outlive the catalog, so it gets its own copy of everything it needs to connect
+	auto &conn = catalog.GetConnection();
+	thread(Revalidate, revalidation, conn.GetLogonString(), conn.GetBufferSize(), std::move(schema_names)).detach();
+}
+
+void TeradataCatalogCache::Revalidate(const shared_ptr<TeradataRevalidationState> &state, const string &logon_string,
+                                      idx_t buffer_size, const vector<string> &schema_names) {
+	try {
+		// Use a separate session, the catalog session is busy serving queries
+		TeradataConnection conn(logon_string, buffer_size);
+		for (auto &schema_name : schema_names) {
+			// Listing the tables is cheap, unlike loading the columns of all of them
+			const auto versions = TeradataTableSet::LoadTableVersions(conn, schema_name);
+
+			vector<TeradataCachedColumn> snapshot;
+			{
+				lock_guard<mutex> guard(state->lock);
+				if (!state->cache) {
+					// The cache has been destroyed in the meantime, e.g. by a DETACH
+					return;
+				}
+				if (!state->cache->TryGetColumns(schema_name, snapshot)) {
+					continue;
+				}
+			}
+
+			// Keep the tables that have not changed. New tables and tables whose columns were not in the snapshot
+			// (yet) are kept as placeholders, the columns are only reloaded for the changed tables that had them.
+			bool changed = false;
+			vector<TeradataCachedColumn> columns;
+			vector<string> reload_tables;
+			unordered_set<string> known_tables;
+			for (auto &column : snapshot) {
+				const auto version = versions.find(column.table_name);
+				if (version == versions.end()) {
+					// Dropped
+					changed = true;
+					continue;
+				}
+				known_tables.insert(column.table_name);
+				if (version->second == column.last_altered) {
+					columns.push_back(std::move(column));
+				} else if (column.IsPlaceholder()) {
+					columns.push_back(TeradataCachedColumn::Placeholder(column.table_name, version->second));
+					changed = true;
+				} else if (reload_tables.empty() || reload_tables.back() != column.table_name) {
+					reload_tables.push_back(column.table_name);
+					changed = true;
+				}
+			}
+			for (auto &version : versions) {
+				if (known_tables.find(version.first) == known_tables.end()) {
+					columns.push_back(TeradataCachedColumn::Placeholder(version.first, version.second));
+					changed = true;
+				}
+			}
+			if (!changed) {
+				continue;
+			}
+			if (!reload_tables.empty()) {
+				for (auto &column : TeradataTableSet::LoadColumns(conn, schema_name, reload_tables)) {
+					columns.push_back(std::move(column));
+				}
+			}
+			// The columns of a table have to stay together, in order
+			std::stable_sort(columns.begin(), columns.end(),
+			                 [](const TeradataCachedColumn &a, const TeradataCachedColumn &b) {
+				                 return a.table_name < b.table_name;
+			                 });
+
+			lock_guard<mutex> guard(state->lock);
+			if (!state->cache) {
+				return;
+			}
+			state->cache->ApplyRevalidation(schema_name, std::move(columns));
+		}
+	} catch (std::exception &ex) {
+		// Failing to revalidate leaves the snapshot as it is, the next ATTACH tries again
+	}
+}
+
+void TeradataCatalogCache::ApplyRevalidation(const string &schema_name, vector<TeradataCachedColumn> columns) {
+	lock_guard<mutex> guard(lock);
+	const auto entry = schemas.find(schema_name);
+	if (entry == schemas.end() || entry->second == columns) {
+		// Invalidated in the meantime, or unchanged
+		return;
+	}
+	entry->second = std::move(columns);
+	changed_schemas.push_back(schema_name);
+	Write();
+}
+
+vector<string> TeradataCatalogCache::TakeChangedSchemas() {
+	lock_guard<mutex> guard(lock);
+	vector<string> result;
+	std::swap(result, changed_schemas);
+	return result;
+}
+
+} // namespace duckdb
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/shared_ptr.hpp"
+
+namespace duckdb {
+
+class FileSystem;
+class TeradataCatalog;
+class TeradataCatalogCache;
+
+// A column of a Teradata table, as loaded from DBC.ColumnsV.
+// A column without a name only marks the existence of a table whose columns have not been loaded yet.
+struct TeradataCachedColumn {
+	string table_name;
+	string column_name;
+	string column_type;
+	int32_t column_length = 0;
+	// When the table of the column was last altered, used to detect changed tables
+	string last_altered;
+
+	static TeradataCachedColumn Placeholder(const string &table_name, const string &last_altered) {
+		TeradataCachedColumn result;
+		result.table_name = table_name;
+		result.last_altered = last_altered;
+		return result;
+	}
+	bool IsPlaceholder() const {
+		return column_name.empty();
+	}
+
+	bool operator==(const TeradataCachedColumn &other) const {
+		return table_name == other.table_name && column_name == other.column_name &&
+		       column_type == other.column_type && column_length == other.column_length &&
+		       last_altered == other.last_altered;
+	}
+};
+
+// The state shared with the background revalidation of a snapshot. The revalidation thread is detached, so that DETACH
+// or shutdown never waits for a slow DBC query. It only accesses the cache while holding the lock, and stops once the
+// cache has been destroyed.
+struct TeradataRevalidationState {
+	mutex lock;
+	optional_ptr<TeradataCatalogCache> cache;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+// Catalog Cache
+//----------------------------------------------------------------------------------------------------------------------
+// A snapshot of the tables and columns of the schemas of an attached Teradata database, persisted to a local file.
+// Loading all tables from the DBC views can take a long time on large databases, so the snapshot is used to populate
+// the catalog on the next ATTACH instead, while it is revalidated against Teradata in the background.
+class TeradataCatalogCache {
+public:
+	TeradataCatalogCache(FileSystem &fs, string path);
+	~TeradataCatalogCache();
+
+	//! The path of the cache file for a logon, within the given directory
+	static string GetCachePath(FileSystem &fs, const string &directory, const string &host, const string &user,
+	                           const string &database);
+
+	//! Read the snapshot from the cache file. A missing or unreadable file results in an empty snapshot.
+	void Load();
+
+	//! Get the columns of all tables in the schema, returns false if the schema is not in the snapshot
+	bool TryGetColumns(const string &schema_name, vector<TeradataCachedColumn> &result);
+	//! Whether the schema is in the snapshot
+	bool HasColumns(const string &schema_name);
+	//! Store the columns of all tables in the schema, and write the snapshot to the cache file
+	void SetColumns(const string &schema_name, vector<TeradataCachedColumn> columns);
+	//! Remove a schema from the snapshot, e.g. because a table was created or dropped in it
+	void Invalidate(const string &schema_name);
+	//! Remove all schemas from the snapshot
+	void Clear();
+
+	//! Revalidate all schemas in the snapshot against Teradata in the background, over a new session. Only the tables
+	//! are listed, the columns are only reloaded for tables that have changed and whose columns were in the snapshot.
+	//! Schemas that have changed are updated in the cache file, and remembered to be refreshed in the catalog.
+	void StartRevalidation(TeradataCatalog &catalog);
+	//! Get (and forget) the schemas that the revalidation found to have changed since the snapshot was taken
+	vector<string> TakeChangedSchemas();
+
+private:
+	static void Revalidate(const shared_ptr<TeradataRevalidationState> &state, const string &logon_string,
+	                       idx_t buffer_size, const vector<string> &schema_names);
+	void ApplyRevalidation(const string &schema_name, vector<TeradataCachedColumn> columns);
+	void Write();
+
+private:
+	FileSystem &fs;
+	string path;
+
+	mutex lock;
+	case_insensitive_map_t<vector<TeradataCachedColumn>> schemas;
+
+	// The schemas that have changed since the snapshot was taken, and have not been refreshed in the catalog yet
+	vector<string> changed_schemas;
+
+	shared_ptr<TeradataRevalidationState> revalidation;
+};
+
+} // namespace duckdb
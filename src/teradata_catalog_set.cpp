@@ -2,6 +2,7 @@
 #include "teradata_schema_entry.hpp"
 #include "teradata_transaction.hpp"
 #include "teradata_connection.hpp"
+#include "teradata_catalog.hpp"
 
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/parser/parsed_data/drop_info.hpp"
@@ -21,12 +22,25 @@ void TeradataCatalogSet::TryLoadEntries(ClientContext &context) {
 
 void TeradataCatalogSet::Scan(ClientContext &context, const std::function<void(CatalogEntry &)> &callback) {
 	TryLoadEntries(context);
+	{
+		lock_guard<mutex> lock(load_lock);
+		LoadDeferredEntries(context);
+	}
 	// TODO: lock this too
 	for (auto &entry : entries) {
 		callback(*entry.second);
 	}
 }
 
+void TeradataCatalogSet::ScanNames(ClientContext &context, const std::function<void(const string &)> &callback) {
+	TryLoadEntries(context);
+	lock_guard<mutex> lock(load_lock);
+	for (auto &entry : entries) {
+		callback(entry.first);
+	}
+	ScanDeferredNames(callback);
+}
+
 optional_ptr<CatalogEntry> TeradataCatalogSet::CreateEntry(unique_ptr<CatalogEntry> entry) {
 	lock_guard<mutex> l(entry_lock);
 	auto result = entry.get();
@@ -61,13 +75,28 @@ void TeradataCatalogSet::DropEntry(ClientContext &context, DropInfo &info) {
 	}
 
 	// Execute the drop query
-	const auto &transaction = TeradataTransaction::Get(context, catalog);
+	auto &transaction = TeradataTransaction::Get(context, catalog);
 	auto &conn = transaction.GetConnection();
 
 	conn.Execute(drop_query);
 
+	// The local catalog snapshot no longer reflects this schema
+	const auto cache = catalog.Cast<TeradataCatalog>().GetCatalogCache();
+	if (cache && info.type == CatalogType::TABLE_ENTRY) {
+		if (info.schema.empty()) {
+			cache->Clear();
+		} else {
+			cache->Invalidate(info.schema);
+		}
+	}
+
 	// erase the entry from the catalog set
 	lock_guard<mutex> l(entry_lock);
+	const auto name_entry = entry_map.find(info.name);
+	if (name_entry != entry_map.end()) {
+		entries.erase(name_entry->second);
+		entry_map.erase(name_entry);
+	}
 	entries.erase(info.name);
 }
 
@@ -79,23 +108,19 @@ optional_ptr<CatalogEntry> TeradataCatalogSet::GetEntry(ClientContext &context,
 		if (entry != entries.end()) {
 			return entry->second.get();
 		}
-	}
 
-	// entry not found
-	// TODO: Try to reload the catalog!
-	auto name_entry = entry_map.find(name);
-	if (name_entry == entry_map.end()) {
-		// no entry found
-		return nullptr;
-	}
-	// try again with the entry we found in the case insensitive map
-	auto entry = entries.find(name_entry->second);
-	if (entry == entries.end()) {
-		// still not found
-		return nullptr;
+		// try again with the entry we find in the case insensitive map
+		auto name_entry = entry_map.find(name);
+		if (name_entry != entry_map.end()) {
+			entry = entries.find(name_entry->second);
+			return entry == entries.end() ? nullptr : entry->second.get();
+		}
 	}
 
-	return entry->second.get();
+	// entry not found: it may not have been loaded yet, or may have been created since we loaded the entries.
+	// Loading it creates the entry, which takes the entry lock again, so it must have been released here.
+	lock_guard<mutex> lock(load_lock);
+	return LoadDeferredEntry(context, name);
 }
 
 TeradataInSchemaSet::TeradataInSchemaSet(TeradataSchemaEntry &schema)
@@ -110,7 +135,43 @@ optional_ptr<CatalogEntry> TeradataInSchemaSet::CreateEntry(unique_ptr<CatalogEn
 void TeradataCatalogSet::ClearEntries() {
 	entry_map.clear();
 	entries.clear();
+	retired_entries.clear();
 	is_loaded = false;
 }
 
+void TeradataCatalogSet::Refresh(ClientContext &context) {
+	lock_guard<mutex> lock(load_lock);
+	if (!is_loaded) {
+		// Nothing to refresh, the entries are loaded fresh on first use
+		return;
+	}
+	RefreshEntries(context);
+}
+
+void TeradataCatalogSet::RefreshEntries(ClientContext &context) {
+	{
+		lock_guard<mutex> l(entry_lock);
+		for (auto &entry : entries) {
+			retired_entries.push_back(std::move(entry.second));
+		}
+		entries.clear();
+		entry_map.clear();
+	}
+	LoadEntries(context);
+}
+
+void TeradataCatalogSet::ReplaceEntry(const string &name, unique_ptr<CatalogEntry> entry) {
+	lock_guard<mutex> l(entry_lock);
+	const auto existing = entries.find(name);
+	if (existing != entries.end()) {
+		retired_entries.push_back(std::move(existing->second));
+		entries.erase(existing);
+	}
+	entry_map.erase(name);
+	if (entry) {
+		entry_map.emplace(name, name);
+		entries.emplace(name, std::move(entry));
+	}
+}
+
 } // namespace duckdb
\ No newline at end of file
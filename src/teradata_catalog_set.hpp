@@ -24,9 +24,12 @@ public:
 	explicit TeradataCatalogSet(Catalog &catalog);
 	virtual ~TeradataCatalogSet() = default;
 
-	// Scan all entries in this set
+	// Scan all entries in this set, loading any deferred entries. Only used to list the entries explicitly.
 	void Scan(ClientContext &context, const std::function<void(CatalogEntry &)> &callback);
 
+	// Scan the names of all entries in this set, without loading the deferred entries
+	void ScanNames(ClientContext &context, const std::function<void(const string &)> &callback);
+
 	// Create an entry in the set
 	virtual optional_ptr<CatalogEntry> CreateEntry(unique_ptr<CatalogEntry> entry);
 
@@ -37,23 +40,47 @@ public:
 	optional_ptr<CatalogEntry> GetEntry(ClientContext &context, const string &name);
 
 	// Reset this set, clearing all cached entries
-	void ClearEntries();
+	virtual void ClearEntries();
+
+	// Bring the entries of this set up to date with Teradata, if they have been loaded
+	void Refresh(ClientContext &context);
 
 protected:
 	// Needs to be implemented by subclasses: method to load the entries of this set
 	virtual void LoadEntries(ClientContext &context) = 0;
 
+	// Can be overridden by subclasses to only reload the entries that have changed. By default, reloads all entries.
+	virtual void RefreshEntries(ClientContext &context);
+
+	// Can be overridden by subclasses that defer loading (parts of) their entries until they are used.
+	// Loads a single entry by name, or all entries that have not been loaded yet.
+	virtual optional_ptr<CatalogEntry> LoadDeferredEntry(ClientContext &context, const string &name) {
+		return nullptr;
+	}
+	virtual void LoadDeferredEntries(ClientContext &context) {
+	}
+	virtual void ScanDeferredNames(const std::function<void(const string &)> &callback) {
+	}
+
+	// Replace (or with a nullptr, remove) a loaded entry
+	void ReplaceEntry(const string &name, unique_ptr<CatalogEntry> entry);
+
 	Catalog &catalog;
 	unordered_map<string, unique_ptr<CatalogEntry>> entries = {};
 
 	// Case insensitive entry map
 	case_insensitive_map_t<string> entry_map = {};
 
-private:
 	void TryLoadEntries(ClientContext &context);
+
+private:
 	mutex load_lock;
 	mutex entry_lock;
 	bool is_loaded = false;
+
+	// Entries replaced by a refresh may still be referenced by bound queries, so keep them alive until the set is
+	// cleared
+	vector<unique_ptr<CatalogEntry>> retired_entries;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
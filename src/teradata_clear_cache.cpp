@@ -34,6 +34,18 @@ void TeradataClearCacheFunction::Clear(ClientContext &context) {
 	}
 }
 
+void TeradataClearCacheFunction::Refresh(ClientContext &context) {
+	auto databases = DatabaseManager::Get(context).GetDatabases(context);
+	for (auto &db_ref : databases) {
+		auto &db = *db_ref.get();
+		auto &catalog = db.GetCatalog();
+		if (catalog.GetCatalogType() != "teradata") {
+			continue;
+		}
+		catalog.Cast<TeradataCatalog>().RefreshCache(context);
+	}
+}
+
 static void ClearCacheFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &data = data_p.bind_data->CastNoConst<ClearCacheFunctionData>();
 	if (data.finished) {
@@ -43,9 +55,21 @@ static void ClearCacheFunction(ClientContext &context, TableFunctionInput &data_
 	data.finished = true;
 }
 
+static void RefreshCacheFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.bind_data->CastNoConst<ClearCacheFunctionData>();
+	if (data.finished) {
+		return;
+	}
+	TeradataClearCacheFunction::Refresh(context);
+	data.finished = true;
+}
+
 void TeradataClearCacheFunction::Register(ExtensionLoader &loader) {
 	TableFunction func("teradata_clear_cache", {}, ClearCacheFunction, ClearCacheBind);
 	loader.RegisterFunction(func);
+
+	TableFunction refresh_func("teradata_refresh_cache", {}, RefreshCacheFunction, ClearCacheBind);
+	loader.RegisterFunction(refresh_func);
 }
 
 } // namespace duckdb
@@ -7,6 +7,8 @@ class ClientContext;
 
 struct TeradataClearCacheFunction {
 	static void Clear(ClientContext &context);
+	// Only reload the catalog entries that have changed in Teradata, instead of clearing everything
+	static void Refresh(ClientContext &context);
 	static void Register(ExtensionLoader &loader);
 };
 
@@ -94,14 +94,14 @@ void TeradataConnection::Execute(const string &sql, DataChunk &chunk, ArenaAlloc
 	ctx.Execute(sql, chunk, arena, writers);
 }
 
-unique_ptr<TeradataQueryResult> TeradataConnection::Query(const string &sql, bool materialize) {
-
-	// TODO: Pool request contexts
-	auto ctx = make_uniq<TeradataRequestContext>(*this);
-
-	vector<TeradataType> types;
-	ctx->Query(sql, types);
+void TeradataConnection::QueryEach(const string &sql, DataChunk &chunk, ArenaAllocator &arena,
+                                   vector<unique_ptr<TeradataColumnWriter>> &writers, ColumnDataCollection &result) {
+	TeradataRequestContext ctx(*this);
+	ctx.QueryEach(sql, chunk, arena, writers, result);
+}
 
+static unique_ptr<TeradataQueryResult> MakeQueryResult(unique_ptr<TeradataRequestContext> ctx,
+                                                       vector<TeradataType> types, bool materialize) {
 	if (materialize) {
 		// Fetch all into a CDC and return a materialized result
 		auto cdc = ctx->FetchAll(types);
@@ -112,6 +112,63 @@ unique_ptr<TeradataQueryResult> TeradataConnection::Query(const string &sql, boo
 	}
 }
 
+unique_ptr<TeradataQueryResult> TeradataConnection::Query(const string &sql, bool materialize) {
+
+	// TODO: Pool request contexts
+	auto ctx = make_uniq<TeradataRequestContext>(*this);
+
+	vector<TeradataType> types;
+	ctx->Query(sql, types);
+
+	return MakeQueryResult(std::move(ctx), std::move(types), materialize);
+}
+
+unique_ptr<TeradataQueryResult> TeradataConnection::Query(const string &sql, DataChunk &params, ArenaAllocator &arena,
+                                                          vector<unique_ptr<TeradataColumnWriter>> &writers,
+                                                          bool materialize) {
+	auto ctx = make_uniq<TeradataRequestContext>(*this);
+
+	vector<TeradataType> types;
+	ctx->Query(sql, params, arena, writers, types);
+
+	return MakeQueryResult(std::move(ctx), std::move(types), materialize);
+}
+
+vector<unique_ptr<TeradataQueryResult>> TeradataConnection::QueryBatch(const vector<string> &statements) {
+	// The statements of a multi-statement request are separated by semicolons
+	vector<string> trimmed;
+	for (auto statement : statements) {
+		StringUtil::RTrim(statement);
+		while (!statement.empty() && statement.back() == ';') {
+			statement.pop_back();
+			StringUtil::RTrim(statement);
+		}
+		if (!statement.empty()) {
+			trimmed.push_back(std::move(statement));
+		}
+	}
+	if (trimmed.empty()) {
+		throw InvalidInputException("Cannot execute an empty Teradata request");
+	}
+
+	TeradataRequestContext ctx(*this);
+
+	vector<vector<TeradataType>> types;
+	vector<unique_ptr<ColumnDataCollection>> cdcs;
+	ctx.QueryBatch(StringUtil::Join(trimmed, ";\n") + ";", types, cdcs);
+
+	vector<unique_ptr<TeradataQueryResult>> results;
+	for (idx_t stmt_idx = 0; stmt_idx < cdcs.size(); stmt_idx++) {
+		if (!cdcs[stmt_idx]) {
+			results.push_back(nullptr);
+			continue;
+		}
+		results.push_back(
+		    make_uniq<MaterializedTeradataQueryResult>(std::move(types[stmt_idx]), std::move(cdcs[stmt_idx])));
+	}
+	return results;
+}
+
 void TeradataConnection::Prepare(const string &sql, vector<TeradataType> &types, vector<string> &names) {
 	// TODO: Pool request contexts
 	TeradataRequestContext td_ctx(*this);
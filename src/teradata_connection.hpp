@@ -48,9 +48,21 @@ public:
 	void Execute(const string &sql, DataChunk &chunk, ArenaAllocator &arena,
 	             vector<unique_ptr<TeradataColumnWriter>> &writers);
 
+	// Execute a parameterized query once for each row in the chunk, collecting the result rows of all of them
+	void QueryEach(const string &sql, DataChunk &chunk, ArenaAllocator &arena,
+	               vector<unique_ptr<TeradataColumnWriter>> &writers, ColumnDataCollection &result);
+
 	// Execute a query with a result set, optionally materializing everything
 	unique_ptr<TeradataQueryResult> Query(const string &sql, bool materialize);
 
+	// Execute a parameterized query with a result set, with the parameters in the single row of the chunk
+	unique_ptr<TeradataQueryResult> Query(const string &sql, DataChunk &params, ArenaAllocator &arena,
+	                                      vector<unique_ptr<TeradataColumnWriter>> &writers, bool materialize);
+
+	// Execute multiple statements as a single multi-statement request, saving a round trip per statement.
+	// The results are materialized, statements without a result set (e.g. DDL) have a nullptr result
+	vector<unique_ptr<TeradataQueryResult>> QueryBatch(const vector<string> &statements);
+
 	// Prepare a query
 	void Prepare(const string &sql, vector<TeradataType> &types, vector<string> &names);
 
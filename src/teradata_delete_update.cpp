@@ -1,11 +1,16 @@
 #include "teradata_delete_update.hpp"
 #include "teradata_catalog.hpp"
 #include "teradata_transaction.hpp"
+#include "teradata_expression.hpp"
+#include "teradata_filter.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/execution/operator/filter/physical_filter.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/optional_filter.hpp"
 #include "duckdb/planner/operator/logical_delete.hpp"
 #include "duckdb/planner/operator/logical_update.hpp"
 
@@ -73,13 +78,56 @@ InsertionOrderPreservingMap<string> TeradataDeleteUpdate::ParamsToString() const
 // Plan
 //----------------------------------------------------------------------------------------------------------------------
 
-// Attempt to reconstruct the WHERE clause from the physical operator tree
-static string ExtractFilters(PhysicalOperator &child, const string &statement) {
+// Resolves references to the output columns of a physical operator, given the Teradata SQL for each of its columns
+static TeradataExpression::column_resolver_t GetColumnResolver(const vector<string> &columns) {
+	return [&columns](const Expression &expr, string &result) {
+		if (expr.GetExpressionClass() != ExpressionClass::BOUND_REF) {
+			return false;
+		}
+		const auto index = expr.Cast<BoundReferenceExpression>().index;
+		if (index >= columns.size() || columns[index].empty()) {
+			return false;
+		}
+		result = columns[index];
+		return true;
+	};
+}
+
+// Teradata orders strings differently (ignoring case for NOT CASESPECIFIC columns), so a range comparison of strings
+// would modify other rows than DuckDB selects, and the modified rows are never checked locally.
+static bool IsStringRangeFilter(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		return constant_filter.constant.type().id() == LogicalTypeId::VARCHAR &&
+		       constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL &&
+		       constant_filter.comparison_type != ExpressionType::COMPARE_NOTEQUAL;
+	}
+	case TableFilterType::CONJUNCTION_AND:
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction_filter = filter.Cast<ConjunctionFilter>();
+		for (auto &child_filter : conjunction_filter.child_filters) {
+			if (IsStringRangeFilter(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::OPTIONAL_FILTER:
+		return IsStringRangeFilter(*filter.Cast<OptionalFilter>().child_filter);
+	default:
+		return false;
+	}
+}
+
+// Attempt to reconstruct the WHERE clause from the physical operator tree.
+// Also returns the Teradata SQL for each of the output columns of the operator, empty if it has none.
+static string ExtractFilters(PhysicalOperator &child, const string &statement, vector<string> &columns) {
 	switch (child.type) {
 	case PhysicalOperatorType::FILTER: {
 		const auto &filter = child.Cast<PhysicalFilter>();
-		const auto result = ExtractFilters(child.children[0], statement);
-		auto filter_str = filter.expression->ToString();
+		const auto result = ExtractFilters(child.children[0], statement, columns);
+		auto filter_str = TeradataExpression::Transform(*filter.expression, GetColumnResolver(columns));
 		if (result.empty()) {
 			return filter_str;
 		}
@@ -87,47 +135,58 @@ static string ExtractFilters(PhysicalOperator &child, const string &statement) {
 	}
 	case PhysicalOperatorType::PROJECTION: {
 		const auto &proj = child.Cast<PhysicalProjection>();
+		vector<string> child_columns;
+		auto result = ExtractFilters(child.children[0], statement, child_columns);
+
+		const auto resolver = GetColumnResolver(child_columns);
+		columns.clear();
 		for (auto &expr : proj.select_list) {
-			switch (expr->type) {
-			case ExpressionType::BOUND_REF:
-			case ExpressionType::BOUND_COLUMN_REF:
-			case ExpressionType::VALUE_CONSTANT:
-				break;
-			default:
-				throw NotImplementedException("Unsupported expression type in projection - only simple deletes/updates "
-				                              "are supported in the Teradata connector");
+			// Only fail once a column we can not express in Teradata is actually referenced
+			string column;
+			if (!TeradataExpression::TryTransformValue(*expr, resolver, column)) {
+				column.clear();
 			}
+			columns.push_back(std::move(column));
 		}
-		return ExtractFilters(child.children[0], statement);
+		return result;
 	}
 	case PhysicalOperatorType::TABLE_SCAN: {
 		const auto &table_scan = child.Cast<PhysicalTableScan>();
+
+		vector<column_t> column_ids;
+		for (auto &col : table_scan.column_ids) {
+			column_ids.push_back(col.GetPrimaryIndex());
+		}
+
+		// The columns of the scan, as referenced by the operators above it
+		columns.clear();
+		const auto &projection_ids = table_scan.projection_ids;
+		const auto column_count = projection_ids.empty() ? column_ids.size() : projection_ids.size();
+		for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
+			const auto col_id = column_ids[projection_ids.empty() ? col_idx : projection_ids[col_idx]];
+			columns.push_back(col_id < table_scan.names.size()
+			                      ? KeywordHelper::WriteQuoted(table_scan.names[col_id], '"')
+			                      : string());
+		}
+
+		// Any complex filters pushed into the scan are also kept in a filter above it, so only the simple column
+		// filters need to be added here.
 		if (!table_scan.table_filters) {
 			return string();
 		}
-		string result;
 		for (auto &entry : table_scan.table_filters->filters) {
-			const auto column_index = entry.first;
-			const auto &filter = entry.second;
-			string column_name;
-			if (column_index < table_scan.names.size()) {
-				const auto col_id = table_scan.column_ids[column_index].GetPrimaryIndex();
-				if (col_id == COLUMN_IDENTIFIER_ROW_ID) {
-					throw NotImplementedException("RowID column not supported in Teradata DELETE statements - "
-					                              "use a primary key or unique index instead");
-				}
-				column_name = table_scan.names[col_id];
+			if (column_ids[entry.first] == COLUMN_IDENTIFIER_ROW_ID) {
+				throw NotImplementedException("RowID column not supported in Teradata %s statements - "
+				                              "use a primary key or unique index instead",
+				                              statement);
 			}
-			BoundReferenceExpression bound_ref(std::move(column_name), LogicalTypeId::INVALID, 0);
-			const auto filter_expr = filter->ToExpression(bound_ref);
-			auto filter_str = filter_expr->ToString();
-			if (result.empty()) {
-				result = std::move(filter_str);
-			} else {
-				result += " AND " + filter_str;
+			if (IsStringRangeFilter(*entry.second)) {
+				throw NotImplementedException("Range comparisons of strings are not supported in Teradata %s "
+				                              "statements, as Teradata orders strings differently than DuckDB",
+				                              statement);
 			}
 		}
-		return result;
+		return TeradataFilter::Transform(column_ids, table_scan.table_filters.get(), table_scan.names);
 	}
 	default:
 		throw NotImplementedException("Unsupported operator type %s in %s statement - only simple deletes "
@@ -147,7 +206,8 @@ static string ConstructDeleteStatement(LogicalDelete &op, PhysicalOperator &chil
 	result += KeywordHelper::WriteQuoted(op.table.schema.name, '"');
 	result += ".";
 	result += KeywordHelper::WriteQuoted(op.table.name, '"');
-	const auto filters = ExtractFilters(child, "DELETE");
+	vector<string> columns;
+	const auto filters = ExtractFilters(child, "DELETE", columns);
 	if (!filters.empty()) {
 		result += " WHERE " + filters;
 	}
@@ -173,7 +233,7 @@ PhysicalOperator &TeradataCatalog::PlanDelete(ClientContext &context, PhysicalPl
 static string ConstructUpdateStatement(LogicalUpdate &op, PhysicalOperator &child) {
 	// FIXME - all of this is pretty gnarly, we should provide a hook earlier on
 	// in the planning process to convert this into a SQL statement
-	string result = "UPDATE";
+	string result = "UPDATE ";
 	result += KeywordHelper::WriteQuoted(op.table.schema.name, '"');
 	result += ".";
 	result += KeywordHelper::WriteQuoted(op.table.name, '"');
@@ -183,6 +243,11 @@ static string ConstructUpdateStatement(LogicalUpdate &op, PhysicalOperator &chil
 		                              "child of an update to be a projection");
 	}
 	auto &proj = child.Cast<PhysicalProjection>();
+
+	vector<string> columns;
+	const auto filters = ExtractFilters(child.children[0], "UPDATE", columns);
+	const auto resolver = GetColumnResolver(columns);
+
 	for (idx_t c = 0; c < op.columns.size(); c++) {
 		if (c > 0) {
 			result += ", ";
@@ -198,10 +263,8 @@ static string ConstructUpdateStatement(LogicalUpdate &op, PhysicalOperator &chil
 			throw NotImplementedException("Teradata Update not supported - Expected a bound reference expression");
 		}
 		auto &ref = op.expressions[c]->Cast<BoundReferenceExpression>();
-		result += proj.select_list[ref.index]->ToString();
+		result += TeradataExpression::TransformValue(*proj.select_list[ref.index], resolver);
 	}
-	result += " ";
-	auto filters = ExtractFilters(child.children[0], "UPDATE");
 	if (!filters.empty()) {
 		result += " WHERE " + filters;
 	}
@@ -11,13 +11,13 @@ namespace duckdb {
 // Bind
 //----------------------------------------------------------------------------------------------------------------------
 struct TeradataExecuteBindData final : public TableFunctionData {
-	TeradataExecuteBindData(TeradataCatalog &td_catalog, string query_p)
-	    : td_catalog(td_catalog), query(std::move(query_p)) {
+	TeradataExecuteBindData(TeradataCatalog &td_catalog, vector<string> statements_p)
+	    : td_catalog(td_catalog), statements(std::move(statements_p)) {
 	}
 
 	bool finished = false;
 	TeradataCatalog &td_catalog;
-	string query;
+	vector<string> statements;
 };
 
 static unique_ptr<FunctionData> Bind(ClientContext &context, TableFunctionBindInput &input,
@@ -37,7 +37,27 @@ static unique_ptr<FunctionData> Bind(ClientContext &context, TableFunctionBindIn
 		throw BinderException("Attached database \"%s\" does not refer to a Teradata database", db_name);
 	}
 	auto &td_catalog = catalog.Cast<TeradataCatalog>();
-	return make_uniq<TeradataExecuteBindData>(td_catalog, input.inputs[1].GetValue<string>());
+
+	// Either a single SQL string, or a list of statements to send together as one multi-statement request
+	vector<string> statements;
+	const auto &sql_value = input.inputs[1];
+	if (sql_value.IsNull()) {
+		throw BinderException("teradata_execute requires a non-NULL SQL statement");
+	}
+	if (sql_value.type().id() == LogicalTypeId::LIST) {
+		for (auto &child : ListValue::GetChildren(sql_value)) {
+			if (child.IsNull()) {
+				throw BinderException("teradata_execute requires non-NULL SQL statements");
+			}
+			statements.push_back(child.GetValue<string>());
+		}
+		if (statements.empty()) {
+			throw BinderException("teradata_execute requires at least one SQL statement");
+		}
+	} else {
+		statements.push_back(sql_value.GetValue<string>());
+	}
+	return make_uniq<TeradataExecuteBindData>(td_catalog, std::move(statements));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -49,8 +69,16 @@ static void Execute(ClientContext &context, TableFunctionInput &data_p, DataChun
 		return;
 	}
 
-	const auto &transaction = TeradataTransaction::Get(context, data.td_catalog);
-	transaction.GetConnection().Execute(data.query);
+	auto &transaction = TeradataTransaction::Get(context, data.td_catalog);
+	auto &conn = transaction.GetConnection();
+	if (data.statements.size() == 1) {
+		conn.Execute(data.statements[0]);
+	} else {
+		// Send all statements in a single round trip
+		conn.QueryBatch(data.statements);
+	}
+	// The statements may have changed the objects referenced by queries whose result types we cached
+	data.td_catalog.ClearPrepared();
 	data.finished = true;
 }
 
@@ -59,8 +87,10 @@ static void Execute(ClientContext &context, TableFunctionInput &data_p, DataChun
 //----------------------------------------------------------------------------------------------------------------------
 
 void TeradataExecuteFunction::Register(ExtensionLoader &loader) {
-	TableFunction func("teradata_execute", {LogicalType::VARCHAR, LogicalType::VARCHAR}, Execute, Bind);
-	loader.RegisterFunction(func);
+	TableFunctionSet set("teradata_execute");
+	set.AddFunction(TableFunction({LogicalType::VARCHAR, LogicalType::VARCHAR}, Execute, Bind));
+	set.AddFunction(TableFunction({LogicalType::VARCHAR, LogicalType::LIST(LogicalType::VARCHAR)}, Execute, Bind));
+	loader.RegisterFunction(set);
 }
 
 } // namespace duckdb
@@ -0,0 +1,644 @@
+#include "teradata_expression.hpp"
+#include "teradata_filter.hpp"
+#include "teradata_type.hpp"
+
+#include "duckdb/planner/expression/list.hpp"
+
+namespace duckdb {
+
+//----------------------------------------------------------------------------------------------------------------------
+// Function Mappings
+//----------------------------------------------------------------------------------------------------------------------
+// DuckDB functions that map onto a Teradata function taking the same arguments
+struct TeradataFunctionMapping {
+	const char *duckdb_name;
+	const char *teradata_name;
+};
+
+static constexpr TeradataFunctionMapping FUNCTION_MAPPINGS[] = {
+    {"lower", "LOWER"},
+    {"lcase", "LOWER"},
+    {"upper", "UPPER"},
+    {"ucase", "UPPER"},
+    {"length", "CHARACTER_LENGTH"},
+    {"abs", "ABS"},
+    {"floor", "FLOOR"},
+    {"ceil", "CEILING"},
+    {"ceiling", "CEILING"},
+    {"round", "ROUND"},
+    {"sqrt", "SQRT"},
+    {"ln", "LN"},
+    {"log10", "LOG"},
+    {"exp", "EXP"},
+    {"power", "POWER"},
+    {"pow", "POWER"},
+    {"nullif", "NULLIF"}};
+
+// Infix operators that have the same meaning in Teradata
+struct TeradataOperatorMapping {
+	const char *duckdb_name;
+	const char *teradata_operator;
+};
+
+static constexpr TeradataOperatorMapping OPERATOR_MAPPINGS[] = {{"+", "+"}, {"-", "-"}, {"*", "*"}, {"||", "||"}};
+
+// Parts of date_part and date_trunc, with the corresponding EXTRACT field and TRUNC format
+struct TeradataDatePartMapping {
+	const char *part;
+	const char *extract_field;
+	const char *trunc_format;
+	bool requires_time;
+};
+
+static constexpr TeradataDatePartMapping DATE_PART_MAPPINGS[] = {{"year", "YEAR", "YYYY", false},
+                                                                 {"quarter", nullptr, "Q", false},
+                                                                 {"month", "MONTH", "MM", false},
+                                                                 {"week", nullptr, "IW", false},
+                                                                 {"day", "DAY", "DD", false},
+                                                                 {"hour", "HOUR", nullptr, true},
+                                                                 {"minute", "MINUTE", nullptr, true}};
+
+static const TeradataDatePartMapping *GetDatePart(const string &part) {
+	for (auto &mapping : DATE_PART_MAPPINGS) {
+		if (StringUtil::CIEquals(part, mapping.part)) {
+			return &mapping;
+		}
+	}
+	return nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Helpers
+//----------------------------------------------------------------------------------------------------------------------
+static bool TranspileValue(const Expression &expr, const TeradataExpression::column_resolver_t &resolver,
+                           string &result);
+static bool TranspilePredicate(const Expression &expr, const TeradataExpression::column_resolver_t &resolver,
+                               string &result);
+
+static bool IsNumeric(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool IsTimestamp(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// Whether Teradata casts the values exactly like DuckDB does. E.g. DuckDB rounds when casting a DOUBLE to an INTEGER,
+// but Teradata truncates, so we can not push down such casts.
+static bool IsExactCast(const LogicalType &source, const LogicalType &target) {
+	if (source == target) {
+		return true;
+	}
+	if (source.IsIntegral() && target.IsIntegral()) {
+		return true;
+	}
+	if (IsNumeric(source) && target.id() == LogicalTypeId::DOUBLE) {
+		return true;
+	}
+	if (target.id() == LogicalTypeId::DECIMAL) {
+		if (source.IsIntegral()) {
+			return true;
+		}
+		if (source.id() == LogicalTypeId::DECIMAL) {
+			return DecimalType::GetScale(source) <= DecimalType::GetScale(target);
+		}
+		return false;
+	}
+	if (source.id() == LogicalTypeId::DATE && IsTimestamp(target)) {
+		return true;
+	}
+	if (IsTimestamp(source) && target.id() == LogicalTypeId::DATE) {
+		return true;
+	}
+	return source.id() == LogicalTypeId::VARCHAR && target.id() == LogicalTypeId::VARCHAR;
+}
+
+// Escape the LIKE wildcards in a string, to match it literally using ESCAPE '\'
+static string EscapeLikePattern(const string &str) {
+	string result;
+	for (auto c : str) {
+		if (c == '%' || c == '_' || c == '\\') {
+			result += '\\';
+		}
+		result += c;
+	}
+	return result;
+}
+
+static bool TransformChildren(const vector<unique_ptr<Expression>> &children,
+                              const TeradataExpression::column_resolver_t &resolver, vector<string> &result) {
+	for (auto &child : children) {
+		string child_str;
+		if (!TranspileValue(*child, resolver, child_str)) {
+			return false;
+		}
+		result.push_back(std::move(child_str));
+	}
+	return true;
+}
+
+static bool GetConstantString(const Expression &expr, string &result) {
+	if (expr.type != ExpressionType::VALUE_CONSTANT) {
+		return false;
+	}
+	auto &value = expr.Cast<BoundConstantExpression>().value;
+	if (value.IsNull() || value.type().id() != LogicalTypeId::VARCHAR) {
+		return false;
+	}
+	result = StringValue::Get(value);
+	return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Functions
+//----------------------------------------------------------------------------------------------------------------------
+static bool TransformLikeFunction(const BoundFunctionExpression &func,
+                                  const TeradataExpression::column_resolver_t &resolver, string &result) {
+	const auto &name = func.function.name;
+
+	// Matching a constant at a given position, expressed as a LIKE with an escaped pattern
+	if (name == "prefix" || name == "starts_with" || name == "suffix" || name == "ends_with" || name == "contains") {
+		string needle;
+		if (func.children.size() != 2 || func.children[0]->return_type.id() != LogicalTypeId::VARCHAR ||
+		    !GetConstantString(*func.children[1], needle)) {
+			return false;
+		}
+		string input;
+		if (!TranspileValue(*func.children[0], resolver, input)) {
+			return false;
+		}
+		auto pattern = EscapeLikePattern(needle);
+		if (name == "prefix" || name == "starts_with") {
+			pattern = pattern + "%";
+		} else if (name == "suffix" || name == "ends_with") {
+			pattern = "%" + pattern;
+		} else {
+			pattern = "%" + pattern + "%";
+		}
+		result = "(" + input + " LIKE " + KeywordHelper::WriteQuoted(pattern) + " ESCAPE '\\')";
+		return true;
+	}
+
+	const auto is_like = name == "~~" || name == "like_escape";
+	const auto is_not_like = name == "!~~" || name == "not_like_escape";
+	const auto is_ilike = name == "~~*";
+	const auto is_not_ilike = name == "!~~*";
+	if (!is_like && !is_not_like && !is_ilike && !is_not_ilike) {
+		return false;
+	}
+
+	vector<string> children;
+	if (!TransformChildren(func.children, resolver, children)) {
+		return false;
+	}
+	if (is_ilike || is_not_ilike) {
+		children[0] = "UPPER(" + children[0] + ")";
+		children[1] = "UPPER(" + children[1] + ")";
+	}
+	result = "(" + children[0] + (is_not_like || is_not_ilike ? " NOT LIKE " : " LIKE ") + children[1];
+	if (children.size() == 3) {
+		result += " ESCAPE " + children[2];
+	}
+	result += ")";
+	return true;
+}
+
+static bool TransformDateFunction(const BoundFunctionExpression &func,
+                                  const TeradataExpression::column_resolver_t &resolver, string &result) {
+	const auto &name = func.function.name;
+
+	string part;
+	idx_t input_idx;
+	if (name == "date_part" || name == "datepart" || name == "date_trunc" || name == "datetrunc") {
+		if (func.children.size() != 2 || !GetConstantString(*func.children[0], part)) {
+			return false;
+		}
+		input_idx = 1;
+	} else if (name == "year" || name == "month" || name == "day" || name == "hour" || name == "minute") {
+		if (func.children.size() != 1) {
+			return false;
+		}
+		part = name;
+		input_idx = 0;
+	} else {
+		return false;
+	}
+
+	const auto mapping = GetDatePart(part);
+	if (!mapping) {
+		return false;
+	}
+	const auto &input_type = func.children[input_idx]->return_type;
+	const auto is_date = input_type.id() == LogicalTypeId::DATE;
+	if (!is_date && !IsTimestamp(input_type)) {
+		return false;
+	}
+
+	string input;
+	if (!TranspileValue(*func.children[input_idx], resolver, input)) {
+		return false;
+	}
+
+	if (name == "date_trunc" || name == "datetrunc") {
+		// Teradata can only truncate dates
+		if (!mapping->trunc_format || !is_date) {
+			return false;
+		}
+		result = "TRUNC(" + input + ", '" + mapping->trunc_format + "')";
+		if (IsTimestamp(func.return_type)) {
+			result = "CAST(" + result + " AS " + TeradataType::FromDuckDB(func.return_type).ToString() + ")";
+		} else if (func.return_type.id() != LogicalTypeId::DATE) {
+			return false;
+		}
+		return true;
+	}
+
+	if (!mapping->extract_field || (mapping->requires_time && is_date)) {
+		return false;
+	}
+	result = StringUtil::Format("EXTRACT(%s FROM %s)", mapping->extract_field, input);
+	return true;
+}
+
+static bool TransformArithmetic(const BoundFunctionExpression &func,
+                                const TeradataExpression::column_resolver_t &resolver, string &result) {
+	const auto &name = func.function.name;
+
+	// Only plain numbers and dates, e.g. intervals have no literal representation we can use.
+	// Concatenation is restricted to strings, Teradata would format numbers differently than DuckDB.
+	for (auto &child : func.children) {
+		const auto &type = child->return_type;
+		if (name == "||" ? type.id() != LogicalTypeId::VARCHAR
+		                 : !IsNumeric(type) && type.id() != LogicalTypeId::DATE) {
+			return false;
+		}
+	}
+
+	vector<string> children;
+	if (!TransformChildren(func.children, resolver, children)) {
+		return false;
+	}
+
+	if (name == "-" && children.size() == 1) {
+		result = "(-" + children[0] + ")";
+		return true;
+	}
+	if (children.size() != 2) {
+		return false;
+	}
+
+	for (auto &mapping : OPERATOR_MAPPINGS) {
+		if (name == mapping.duckdb_name) {
+			result = "(" + children[0] + " " + mapping.teradata_operator + " " + children[1] + ")";
+			return true;
+		}
+	}
+
+	// DuckDB returns NULL when dividing by zero, while Teradata raises an error
+	if (name == "/") {
+		// Division always produces a DOUBLE in DuckDB, even for integers
+		if (func.return_type.id() != LogicalTypeId::DOUBLE) {
+			return false;
+		}
+		result = StringUtil::Format("(CAST(%s AS FLOAT) / NULLIF(CAST(%s AS FLOAT), 0))", children[0], children[1]);
+		return true;
+	}
+	if (name == "//") {
+		if (!func.return_type.IsIntegral()) {
+			return false;
+		}
+		result = StringUtil::Format("(%s / NULLIF(%s, 0))", children[0], children[1]);
+		return true;
+	}
+	if (name == "%" || name == "mod") {
+		if (!func.return_type.IsIntegral()) {
+			return false;
+		}
+		result = StringUtil::Format("(%s MOD NULLIF(%s, 0))", children[0], children[1]);
+		return true;
+	}
+	return false;
+}
+
+static bool TransformFunction(const BoundFunctionExpression &func,
+                              const TeradataExpression::column_resolver_t &resolver, string &result) {
+	const auto &name = func.function.name;
+
+	for (auto &mapping : FUNCTION_MAPPINGS) {
+		if (name != mapping.duckdb_name) {
+			continue;
+		}
+		vector<string> children;
+		if (!TransformChildren(func.children, resolver, children)) {
+			return false;
+		}
+		result = string(mapping.teradata_name) + "(" + StringUtil::Join(children, ", ") + ")";
+		return true;
+	}
+
+	if (name == "trim" || name == "ltrim" || name == "rtrim") {
+		// Only trimming spaces, Teradata can not trim a set of characters
+		string input;
+		if (func.children.size() != 1 || !TranspileValue(*func.children[0], resolver, input)) {
+			return false;
+		}
+		const auto trim_spec = name == "ltrim" ? "LEADING FROM " : name == "rtrim" ? "TRAILING FROM " : "";
+		result = "TRIM(" + string(trim_spec) + input + ")";
+		return true;
+	}
+
+	if (name == "substring" || name == "substr") {
+		// DuckDB counts a negative start from the end of the string, and also handles a negative length differently
+		// than Teradata. Only transform a positive constant start and a non-negative constant length.
+		for (idx_t child_idx = 1; child_idx < func.children.size(); child_idx++) {
+			auto &child = *func.children[child_idx];
+			if (child.type != ExpressionType::VALUE_CONSTANT) {
+				return false;
+			}
+			auto &value = child.Cast<BoundConstantExpression>().value;
+			const auto min_value = child_idx == 1 ? 1 : 0;
+			if (value.IsNull() || value.GetValue<int64_t>() < min_value) {
+				return false;
+			}
+		}
+		vector<string> children;
+		if (func.children.size() < 2 || !TransformChildren(func.children, resolver, children)) {
+			return false;
+		}
+		result = "SUBSTRING(" + children[0] + " FROM " + children[1];
+		if (children.size() == 3) {
+			result += " FOR " + children[2];
+		}
+		result += ")";
+		return true;
+	}
+
+	if (TransformDateFunction(func, resolver, result)) {
+		return true;
+	}
+	return TransformArithmetic(func, resolver, result);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Values
+//----------------------------------------------------------------------------------------------------------------------
+static bool TranspileValue(const Expression &expr, const TeradataExpression::column_resolver_t &resolver,
+                           string &result) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_COLUMN_REF:
+	case ExpressionClass::BOUND_REF:
+		return resolver(expr, result);
+	case ExpressionClass::BOUND_CONSTANT: {
+		auto &value = expr.Cast<BoundConstantExpression>().value;
+		if (value.type().id() == LogicalTypeId::INTERVAL) {
+			return false;
+		}
+		result = TeradataFilter::TransformConstant(value);
+		return true;
+	}
+	case ExpressionClass::BOUND_CAST: {
+		auto &cast = expr.Cast<BoundCastExpression>();
+		if (cast.try_cast || !IsExactCast(cast.child->return_type, cast.return_type)) {
+			return false;
+		}
+		string child;
+		if (!TranspileValue(*cast.child, resolver, child)) {
+			return false;
+		}
+		result = "CAST(" + child + " AS " + TeradataType::FromDuckDB(cast.return_type).ToString() + ")";
+		return true;
+	}
+	case ExpressionClass::BOUND_CASE: {
+		auto &case_expr = expr.Cast<BoundCaseExpression>();
+		result = "CASE";
+		for (auto &check : case_expr.case_checks) {
+			string when_str, then_str;
+			if (!TranspilePredicate(*check.when_expr, resolver, when_str) ||
+			    !TranspileValue(*check.then_expr, resolver, then_str)) {
+				return false;
+			}
+			result += " WHEN " + when_str + " THEN " + then_str;
+		}
+		string else_str;
+		if (!TranspileValue(*case_expr.else_expr, resolver, else_str)) {
+			return false;
+		}
+		result += " ELSE " + else_str + " END";
+		return true;
+	}
+	case ExpressionClass::BOUND_OPERATOR: {
+		if (expr.type != ExpressionType::OPERATOR_COALESCE) {
+			return false;
+		}
+		vector<string> children;
+		if (!TransformChildren(expr.Cast<BoundOperatorExpression>().children, resolver, children)) {
+			return false;
+		}
+		result = "COALESCE(" + StringUtil::Join(children, ", ") + ")";
+		return true;
+	}
+	case ExpressionClass::BOUND_FUNCTION: {
+		if (expr.return_type.id() == LogicalTypeId::BOOLEAN) {
+			// Teradata has no boolean values, only predicates
+			return false;
+		}
+		return TransformFunction(expr.Cast<BoundFunctionExpression>(), resolver, result);
+	}
+	default:
+		return false;
+	}
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Predicates
+//----------------------------------------------------------------------------------------------------------------------
+static bool TransformComparison(ExpressionType type, string &result) {
+	switch (type) {
+	case ExpressionType::COMPARE_EQUAL:
+		result = "=";
+		return true;
+	case ExpressionType::COMPARE_NOTEQUAL:
+		result = "<>";
+		return true;
+	case ExpressionType::COMPARE_LESSTHAN:
+		result = "<";
+		return true;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		result = ">";
+		return true;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		result = "<=";
+		return true;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		result = ">=";
+		return true;
+	default:
+		return false;
+	}
+}
+
+// Teradata compares strings ignoring trailing blanks, and ignoring case for NOT CASESPECIFIC columns. This only makes
+// equality more permissive, but changes the order of strings, so range comparisons could drop rows DuckDB would keep.
+static bool IsStringRange(const Expression &input, ExpressionType type) {
+	return input.return_type.id() == LogicalTypeId::VARCHAR && type != ExpressionType::COMPARE_EQUAL &&
+	       type != ExpressionType::COMPARE_NOTEQUAL;
+}
+
+static bool TranspilePredicate(const Expression &expr, const TeradataExpression::column_resolver_t &resolver,
+                               string &result) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_COLUMN_REF:
+	case ExpressionClass::BOUND_REF: {
+		// Booleans are stored as BYTEINT
+		string column;
+		if (expr.return_type.id() != LogicalTypeId::BOOLEAN || !resolver(expr, column)) {
+			return false;
+		}
+		result = "(" + column + " = 1)";
+		return true;
+	}
+	case ExpressionClass::BOUND_CONSTANT: {
+		auto &value = expr.Cast<BoundConstantExpression>().value;
+		if (value.type().id() != LogicalTypeId::BOOLEAN || value.IsNull()) {
+			return false;
+		}
+		result = BooleanValue::Get(value) ? "(1 = 1)" : "(1 = 0)";
+		return true;
+	}
+	case ExpressionClass::BOUND_COMPARISON: {
+		auto &comparison = expr.Cast<BoundComparisonExpression>();
+		string op, left, right;
+		if (IsStringRange(*comparison.left, comparison.type)) {
+			return false;
+		}
+		if (!TransformComparison(comparison.type, op) || !TranspileValue(*comparison.left, resolver, left) ||
+		    !TranspileValue(*comparison.right, resolver, right)) {
+			return false;
+		}
+		result = "(" + left + " " + op + " " + right + ")";
+		return true;
+	}
+	case ExpressionClass::BOUND_CONJUNCTION: {
+		auto &conjunction = expr.Cast<BoundConjunctionExpression>();
+		const auto op = conjunction.type == ExpressionType::CONJUNCTION_AND ? " AND " : " OR ";
+		vector<string> children;
+		for (auto &child : conjunction.children) {
+			string child_str;
+			if (!TranspilePredicate(*child, resolver, child_str)) {
+				return false;
+			}
+			children.push_back(std::move(child_str));
+		}
+		result = "(" + StringUtil::Join(children, op) + ")";
+		return true;
+	}
+	case ExpressionClass::BOUND_BETWEEN: {
+		auto &between = expr.Cast<BoundBetweenExpression>();
+		string input, lower, upper;
+		if (IsStringRange(*between.input, ExpressionType::COMPARE_BETWEEN)) {
+			return false;
+		}
+		if (!TranspileValue(*between.input, resolver, input) || !TranspileValue(*between.lower, resolver, lower) ||
+		    !TranspileValue(*between.upper, resolver, upper)) {
+			return false;
+		}
+		if (between.lower_inclusive && between.upper_inclusive) {
+			result = "(" + input + " BETWEEN " + lower + " AND " + upper + ")";
+		} else {
+			result = "(" + input + (between.lower_inclusive ? " >= " : " > ") + lower + " AND " + input +
+			         (between.upper_inclusive ? " <= " : " < ") + upper + ")";
+		}
+		return true;
+	}
+	case ExpressionClass::BOUND_OPERATOR: {
+		auto &op = expr.Cast<BoundOperatorExpression>();
+		switch (op.type) {
+		case ExpressionType::OPERATOR_NOT: {
+			string child;
+			if (!TranspilePredicate(*op.children[0], resolver, child)) {
+				return false;
+			}
+			result = "(NOT " + child + ")";
+			return true;
+		}
+		case ExpressionType::OPERATOR_IS_NULL:
+		case ExpressionType::OPERATOR_IS_NOT_NULL: {
+			string child;
+			if (!TranspileValue(*op.children[0], resolver, child)) {
+				return false;
+			}
+			result = "(" + child + (op.type == ExpressionType::OPERATOR_IS_NULL ? " IS NULL)" : " IS NOT NULL)");
+			return true;
+		}
+		case ExpressionType::COMPARE_IN:
+		case ExpressionType::COMPARE_NOT_IN: {
+			vector<string> children;
+			if (!TransformChildren(op.children, resolver, children)) {
+				return false;
+			}
+			const auto input = children[0];
+			children.erase(children.begin());
+			result = "(" + input + (op.type == ExpressionType::COMPARE_IN ? " IN (" : " NOT IN (") +
+			         StringUtil::Join(children, ", ") + "))";
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+	case ExpressionClass::BOUND_FUNCTION:
+		return TransformLikeFunction(expr.Cast<BoundFunctionExpression>(), resolver, result);
+	default:
+		return false;
+	}
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Transform
+//----------------------------------------------------------------------------------------------------------------------
+bool TeradataExpression::TryTransform(const Expression &expr, const column_resolver_t &resolver, string &result) {
+	if (expr.return_type.id() == LogicalTypeId::BOOLEAN) {
+		return TranspilePredicate(expr, resolver, result);
+	}
+	return TranspileValue(expr, resolver, result);
+}
+
+bool TeradataExpression::TryTransformValue(const Expression &expr, const column_resolver_t &resolver,
+                                           string &result) {
+	return TranspileValue(expr, resolver, result);
+}
+
+string TeradataExpression::Transform(const Expression &expr, const column_resolver_t &resolver) {
+	string result;
+	if (!TryTransform(expr, resolver, result)) {
+		throw NotImplementedException("Expression \"%s\" can not be translated to Teradata SQL", expr.ToString());
+	}
+	return result;
+}
+
+string TeradataExpression::TransformValue(const Expression &expr, const column_resolver_t &resolver) {
+	string result;
+	if (!TryTransformValue(expr, resolver, result)) {
+		throw NotImplementedException("Expression \"%s\" can not be translated to Teradata SQL", expr.ToString());
+	}
+	return result;
+}
+
+} // namespace duckdb
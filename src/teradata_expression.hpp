@@ -0,0 +1,29 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+class Expression;
+
+// Transpiles bound DuckDB expressions into equivalent Teradata SQL expressions, so that predicates and computations can
+// be evaluated on the Teradata side. Expressions (or functions) without a known Teradata equivalent are rejected.
+class TeradataExpression {
+public:
+	//! Resolves a column reference (BOUND_COLUMN_REF or BOUND_REF) into the Teradata SQL to reference it with.
+	//! Returns false if the column can not be referenced in Teradata.
+	using column_resolver_t = std::function<bool(const Expression &expr, string &result)>;
+
+	//! Try to transform the expression, returns false if it (or any of its children) can not be transformed.
+	//! Boolean expressions are transformed into predicates, e.g. to be used in a WHERE clause.
+	static bool TryTransform(const Expression &expr, const column_resolver_t &resolver, string &result);
+	//! Transform the expression, throwing a NotImplementedException if it can not be transformed
+	static string Transform(const Expression &expr, const column_resolver_t &resolver);
+
+	//! Try to transform the expression into a value, e.g. to assign to a column. Teradata has no boolean values,
+	//! booleans are represented as BYTEINT (1 or 0), so boolean predicates can not be transformed into values.
+	static bool TryTransformValue(const Expression &expr, const column_resolver_t &resolver, string &result);
+	static string TransformValue(const Expression &expr, const column_resolver_t &resolver);
+};
+
+} // namespace duckdb
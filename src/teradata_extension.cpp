@@ -5,6 +5,7 @@
 #include "teradata_secret.hpp"
 #include "teradata_clear_cache.hpp"
 #include "teradata_common.hpp"
+#include "teradata_optimizer.hpp"
 
 #include "duckdb.hpp"
 #include "duckdb/common/exception.hpp"
@@ -41,8 +42,8 @@ public:
 			return RebindQueryInfo::DO_NOT_REBIND;
 		}
 
-		// Try to clear caches and rebind
-		TeradataClearCacheFunction::Clear(context);
+		// Try to reload the tables that have changed and rebind
+		TeradataClearCacheFunction::Refresh(context);
 		return RebindQueryInfo::ATTEMPT_TO_REBIND;
 	}
 };
@@ -69,6 +70,9 @@ static void LoadInternal(ExtensionLoader &loader) {
 	// Register storage
 	instance.config.storage_extensions["teradata"] = make_uniq<TeradataStorageExtension>();
 
+	// Register optimizer
+	TeradataOptimizer::Register(instance.config);
+
 	// Register callbacks
 	instance.config.extension_callbacks.push_back(make_uniq<TeradataExtensionCallback>());
 
@@ -80,6 +84,71 @@ static void LoadInternal(ExtensionLoader &loader) {
 	instance.config.AddExtensionOption("teradata_use_primary_index",
 	                                   "Whether or not to use a primary index when creating Teradata tables",
 	                                   LogicalType::BOOLEAN, Value::BOOLEAN(true));
+
+	instance.config.AddExtensionOption("teradata_parameterize_filters",
+	                                   "Whether or not to pass the constants of pushed down filters to Teradata as "
+	                                   "parameters, allowing Teradata to reuse cached plans across scans",
+	                                   LogicalType::BOOLEAN, Value::BOOLEAN(true));
+
+	instance.config.AddExtensionOption("teradata_complex_filter_pushdown",
+	                                   "Whether or not to translate filters that can not be pushed down as simple column "
+	                                   "filters into Teradata SQL, and let Teradata evaluate them as well",
+	                                   LogicalType::BOOLEAN, Value::BOOLEAN(true));
+
+	instance.config.AddExtensionOption("teradata_use_statistics",
+	                                   "Whether or not to use the statistics collected in Teradata (DBC.StatsV) to "
+	                                   "estimate the cardinality of Teradata scans",
+	                                   LogicalType::BOOLEAN, Value::BOOLEAN(true));
+
+	instance.config.AddExtensionOption("teradata_query_estimate",
+	                                   "Whether or not to EXPLAIN teradata_query queries when binding them, to use the "
+	                                   "row count estimated by Teradata as their cardinality",
+	                                   LogicalType::BOOLEAN, Value::BOOLEAN(false));
+
+	instance.config.AddExtensionOption("teradata_access_lock",
+	                                   "Whether or not to read Teradata tables with an ACCESS lock, so that scans do not "
+	                                   "wait for (or block) concurrent writers",
+	                                   LogicalType::BOOLEAN, Value::BOOLEAN(false));
+
+	instance.config.AddExtensionOption("teradata_join_pushdown",
+	                                   "Whether or not to push joins between Teradata tables down into Teradata",
+	                                   LogicalType::BOOLEAN, Value::BOOLEAN(true));
+
+	instance.config.AddExtensionOption(
+	    "teradata_index_join_threshold",
+	    "Maximum estimated number of rows on the local side of a join with a Teradata table for the join to be "
+	    "executed as batched primary index lookups (0 to disable)",
+	    LogicalType::UBIGINT, Value::UBIGINT(100000));
+
+	instance.config.AddExtensionOption(
+	    "teradata_key_shipping_threshold",
+	    "Minimum estimated number of rows on the local side of a join for its keys to be shipped to a Teradata "
+	    "volatile table to filter the Teradata side of the join with (0 to disable)",
+	    LogicalType::UBIGINT, Value::UBIGINT(10000));
+
+	instance.config.AddExtensionOption(
+	    "teradata_insert_method",
+	    "How to INSERT into Teradata tables: 'direct' inserts the rows into the table, 'staging' inserts them into a "
+	    "volatile table without primary index first and moves them into the table with a single INSERT SELECT",
+	    LogicalType::VARCHAR, Value("direct"));
+
+	instance.config.AddExtensionOption(
+	    "teradata_insert_commit_interval",
+	    "Number of rows after which to commit an INSERT into a Teradata table, inserting over a dedicated session "
+	    "outside of the current transaction (0 to insert within the current transaction)",
+	    LogicalType::UBIGINT, Value::UBIGINT(0));
+
+	instance.config.AddExtensionOption(
+	    "teradata_insert_restart_table",
+	    "Name of a Teradata table to record the number of rows committed by teradata_insert_commit_interval in, per "
+	    "target table. Created in the database of the target table if it does not exist (empty to not record them)",
+	    LogicalType::VARCHAR, Value(""));
+
+	instance.config.AddExtensionOption(
+	    "teradata_missing_table_ttl",
+	    "Number of seconds to remember that a looked up table does not exist in Teradata, before checking again "
+	    "(0 to always check)",
+	    LogicalType::UBIGINT, Value::UBIGINT(60));
 }
 
 void TeradataExtension::Load(ExtensionLoader &loader) {
@@ -1,19 +1,22 @@
 #include "teradata_filter.hpp"
 
 #include <teradata_type.hpp>
+#include <teradata_parameters.hpp>
 #include <duckdb/planner/filter/constant_filter.hpp>
+#include <duckdb/planner/filter/dynamic_filter.hpp>
 #include <duckdb/planner/filter/in_filter.hpp>
 #include <duckdb/planner/filter/optional_filter.hpp>
 #include <duckdb/planner/filter/struct_filter.hpp>
 
 namespace duckdb {
 
-static string TransformFilter(const string &column_name, const TableFilter &filter);
+static string TransformFilter(const string &column_name, const TableFilter &filter,
+                              optional_ptr<TeradataParameters> params);
 static string CreateExpression(const string &column_name, const vector<unique_ptr<TableFilter>> &filters,
-                               const string &op) {
+                               const string &op, optional_ptr<TeradataParameters> params) {
 	vector<string> filter_entries;
 	for (auto &filter : filters) {
-		auto filter_str = TransformFilter(column_name, *filter);
+		auto filter_str = TransformFilter(column_name, *filter, params);
 		if (!filter_str.empty()) {
 			filter_entries.push_back(std::move(filter_str));
 		}
@@ -40,14 +43,98 @@ static string TransformBlob(const string &val) {
 	return result;
 }
 
-static string TransformLiteral(const Value &val) {
-	// TODO: More literals
+static string TransformFloat(const Value &val) {
+	const auto double_val = val.GetValue<double>();
+	if (!Value::DoubleIsFinite(double_val)) {
+		return KeywordHelper::WriteQuoted(val.ToString());
+	}
+	// Without an exponent, Teradata would interpret the literal as a DECIMAL
+	// https://docs.teradata.com/r/Enterprise_IntelliFlex_VMware/SQL-Data-Types-and-Literals/Data-Literals/Floating-Point-Literals
+	auto result = StringUtil::Upper(val.ToString());
+	if (result.find('E') == string::npos) {
+		result += "E0";
+	}
+	return result;
+}
+
+// The time zone of a TIME/TIMESTAMP WITH TIME ZONE literal, e.g. "+05:30"
+static string TransformTimeZone(int32_t offset_seconds) {
+	const auto sign = offset_seconds < 0 ? '-' : '+';
+	const auto offset_minutes = AbsValue(offset_seconds) / Interval::SECS_PER_MINUTE;
+	return StringUtil::Format("%c%02d:%02d", sign, offset_minutes / Interval::MINS_PER_HOUR,
+	                          offset_minutes % Interval::MINS_PER_HOUR);
+}
+
+string TeradataFilter::TransformConstant(const Value &val, optional_ptr<TeradataParameters> params) {
+	if (val.IsNull()) {
+		return "NULL";
+	}
+
+	// Prefer passing the value as a parameter, so that the request text does not depend on it
+	if (params && TeradataParameters::IsSupported(val.type())) {
+		auto placeholder = params->Add(val);
+		if (!placeholder.empty()) {
+			return placeholder;
+		}
+	}
+
+	// Emit typed literals, so that Teradata does not have to implicitly convert the column to compare it with a
+	// string, which can prevent it from using primary indexes and partition elimination.
 	switch (val.type().id()) {
+	case LogicalTypeId::BOOLEAN:
+		// Booleans are stored as BYTEINT
+		return BooleanValue::Get(val) ? "1" : "0";
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::DECIMAL:
+		return val.ToString();
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+		return TransformFloat(val);
+	case LogicalTypeId::DATE:
+		if (!Date::IsFinite(DateValue::Get(val))) {
+			break;
+		}
+		return "DATE " + KeywordHelper::WriteQuoted(val.ToString());
+	case LogicalTypeId::TIME:
+		return "TIME " + KeywordHelper::WriteQuoted(val.ToString());
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS: {
+		const auto ts_val = val.DefaultCastAs(LogicalType::TIMESTAMP);
+		if (!Timestamp::IsFinite(TimestampValue::Get(ts_val))) {
+			break;
+		}
+		return "TIMESTAMP " + KeywordHelper::WriteQuoted(ts_val.ToString());
+	}
+	case LogicalTypeId::TIME_TZ: {
+		// Teradata time zones are whole minutes
+		const auto time_tz = val.GetValue<dtime_tz_t>();
+		if (time_tz.offset() % Interval::SECS_PER_MINUTE != 0) {
+			break;
+		}
+		const auto literal = Time::ToString(time_tz.time()) + TransformTimeZone(time_tz.offset());
+		return "TIME " + KeywordHelper::WriteQuoted(literal);
+	}
+	case LogicalTypeId::TIMESTAMP_TZ: {
+		// The value is stored in UTC, so format it as such, independent of the TimeZone setting
+		const auto ts = timestamp_t(val.GetValue<timestamp_tz_t>().value);
+		if (!Timestamp::IsFinite(ts)) {
+			break;
+		}
+		return "TIMESTAMP " + KeywordHelper::WriteQuoted(Timestamp::ToString(ts) + TransformTimeZone(0));
+	}
 	case LogicalTypeId::BLOB:
 		return TransformBlob(StringValue::Get(val));
 	default:
-		return KeywordHelper::WriteQuoted(val.ToString());
+		break;
 	}
+	return KeywordHelper::WriteQuoted(val.ToString());
 }
 
 static string TransformComparision(ExpressionType type) {
@@ -69,7 +156,8 @@ static string TransformComparision(ExpressionType type) {
 	}
 }
 
-static string TransformFilter(const string &column_name, const TableFilter &filter) {
+static string TransformFilter(const string &column_name, const TableFilter &filter,
+                              optional_ptr<TeradataParameters> params) {
 	switch (filter.filter_type) {
 	case TableFilterType::IS_NULL:
 		return column_name + " IS NULL";
@@ -77,15 +165,15 @@ static string TransformFilter(const string &column_name, const TableFilter &filt
 		return column_name + " IS NOT NULL";
 	case TableFilterType::CONJUNCTION_AND: {
 		auto &conjunction_filter = filter.Cast<ConjunctionAndFilter>();
-		return CreateExpression(column_name, conjunction_filter.child_filters, "AND");
+		return CreateExpression(column_name, conjunction_filter.child_filters, "AND", params);
 	}
 	case TableFilterType::CONJUNCTION_OR: {
 		auto &conjunction_filter = filter.Cast<ConjunctionOrFilter>();
-		return CreateExpression(column_name, conjunction_filter.child_filters, "OR");
+		return CreateExpression(column_name, conjunction_filter.child_filters, "OR", params);
 	}
 	case TableFilterType::CONSTANT_COMPARISON: {
 		auto &constant_filter = filter.Cast<ConstantFilter>();
-		auto constant_string = TransformLiteral(constant_filter.constant);
+		auto constant_string = TeradataFilter::TransformConstant(constant_filter.constant, params);
 		auto operator_string = TransformComparision(constant_filter.comparison_type);
 		return StringUtil::Format("%s %s %s", column_name, operator_string, constant_string);
 	}
@@ -94,7 +182,7 @@ static string TransformFilter(const string &column_name, const TableFilter &filt
 	}
 	case TableFilterType::OPTIONAL_FILTER: {
 		auto &optional_filter = filter.Cast<OptionalFilter>();
-		return TransformFilter(column_name, *optional_filter.child_filter);
+		return TransformFilter(column_name, *optional_filter.child_filter, params);
 	}
 	case TableFilterType::IN_FILTER: {
 		auto &in_filter = filter.Cast<InFilter>();
@@ -103,25 +191,39 @@ static string TransformFilter(const string &column_name, const TableFilter &filt
 			if (!in_list.empty()) {
 				in_list += ", ";
 			}
-			in_list += TransformLiteral(val);
+			in_list += TeradataFilter::TransformConstant(val, params);
 		}
 		return column_name + " IN (" + in_list + ")";
 	}
-	case TableFilterType::DYNAMIC_FILTER:
-		return string();
+	case TableFilterType::DYNAMIC_FILTER: {
+		// Dynamic filters are populated at runtime, e.g. with the boundary of a top-n. Push it if it is already set.
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		if (!dynamic_filter.filter_data) {
+			return string();
+		}
+		lock_guard<mutex> guard(dynamic_filter.filter_data->lock);
+		if (!dynamic_filter.filter_data->initialized || !dynamic_filter.filter_data->filter) {
+			return string();
+		}
+		return TransformFilter(column_name, *dynamic_filter.filter_data->filter, params);
+	}
 	default:
 		throw InternalException("Unsupported table filter type");
 	}
 }
 
 string TeradataFilter::Transform(const vector<column_t> &column_ids, optional_ptr<TableFilterSet> filters,
-                                 const vector<string> &names) {
+                                 const vector<string> &names, const string &alias,
+                                 optional_ptr<TeradataParameters> params) {
 
 	string result;
 	for (auto &entry : filters->filters) {
 		auto col_name = KeywordHelper::WriteQuoted(names[column_ids[entry.first]], '"');
+		if (!alias.empty()) {
+			col_name = alias + "." + col_name;
+		}
 		auto &filter = entry.second;
-		auto filter_text = TransformFilter(col_name, *filter);
+		auto filter_text = TransformFilter(col_name, *filter, params);
 		if (filter_text.empty()) {
 			continue;
 		}
@@ -5,11 +5,17 @@
 namespace duckdb {
 
 class TableFilterSet;
+class TeradataParameters;
 
 class TeradataFilter {
 public:
+	//! Transform the filters into a Teradata WHERE clause, optionally qualifying the columns with a table alias.
+	//! If parameters are passed, the constants are added to them instead of being inlined as literals.
 	static string Transform(const vector<column_t> &column_ids, optional_ptr<TableFilterSet> filters,
-	                        const vector<string> &names);
+	                        const vector<string> &names, const string &alias = string(),
+	                        optional_ptr<TeradataParameters> params = nullptr);
+	//! Transform a constant into a Teradata literal, or a parameter placeholder if parameters are passed
+	static string TransformConstant(const Value &val, optional_ptr<TeradataParameters> params = nullptr);
 };
 
 } // namespace duckdb
@@ -0,0 +1,162 @@
+#include "teradata_index_join.hpp"
+#include "teradata_catalog.hpp"
+#include "teradata_transaction.hpp"
+#include "teradata_connection.hpp"
+#include "teradata_column_writer.hpp"
+
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+
+namespace duckdb {
+
+//----------------------------------------------------------------------------------------------------------------------
+// Physical Operator
+//----------------------------------------------------------------------------------------------------------------------
+PhysicalTeradataIndexJoin::PhysicalTeradataIndexJoin(PhysicalPlan &plan, vector<LogicalType> types,
+                                                     idx_t estimated_cardinality, TeradataCatalog &catalog,
+                                                     string table_name, string sql, vector<idx_t> key_columns,
+                                                     vector<LogicalType> fetch_types)
+    : PhysicalOperator(plan, PhysicalOperatorType::EXTENSION, std::move(types), estimated_cardinality),
+      catalog(catalog), table_name(std::move(table_name)), sql(std::move(sql)), key_columns(std::move(key_columns)),
+      fetch_types(std::move(fetch_types)) {
+}
+
+class TeradataIndexJoinGlobalState final : public GlobalOperatorState {
+public:
+	// The lookups run on the session of our transaction, which only processes one request at a time
+	mutex lock;
+};
+
+class TeradataIndexJoinState final : public OperatorState {
+public:
+	TeradataIndexJoinState(ClientContext &context, const PhysicalTeradataIndexJoin &op)
+	    : arena(BufferAllocator::Get(context)) {
+		vector<LogicalType> key_types;
+		for (auto &col_idx : op.key_columns) {
+			key_types.push_back(op.children[0].get().types[col_idx]);
+			writers.push_back(TeradataColumnWriter::Make(key_types.back()));
+		}
+		keys.Initialize(Allocator::DefaultAllocator(), key_types);
+
+		result_types.push_back(LogicalType::UINTEGER);
+		result_types.insert(result_types.end(), op.fetch_types.begin(), op.fetch_types.end());
+		result_chunk.Initialize(Allocator::DefaultAllocator(), result_types);
+	}
+
+	DataChunk keys;
+	ArenaAllocator arena;
+	vector<unique_ptr<TeradataColumnWriter>> writers;
+
+	vector<LogicalType> result_types;
+	unique_ptr<ColumnDataCollection> result;
+	ColumnDataScanState scan_state;
+	DataChunk result_chunk;
+};
+
+unique_ptr<GlobalOperatorState> PhysicalTeradataIndexJoin::GetGlobalOperatorState(ClientContext &context) const {
+	return make_uniq<TeradataIndexJoinGlobalState>();
+}
+
+unique_ptr<OperatorState> PhysicalTeradataIndexJoin::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<TeradataIndexJoinState>(context.client, *this);
+}
+
+OperatorResultType PhysicalTeradataIndexJoin::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                      GlobalOperatorState &gstate_p, OperatorState &state_p) const {
+	auto &gstate = gstate_p.Cast<TeradataIndexJoinGlobalState>();
+	auto &state = state_p.Cast<TeradataIndexJoinState>();
+
+	if (input.size() == 0) {
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	if (!state.result) {
+		// Look up the rows matching this input chunk
+		state.keys.Reset();
+		for (idx_t key_idx = 0; key_idx < key_columns.size(); key_idx++) {
+			state.keys.data[key_idx].Reference(input.data[key_columns[key_idx]]);
+		}
+		state.keys.SetCardinality(input.size());
+
+		state.result = make_uniq<ColumnDataCollection>(Allocator::DefaultAllocator(), state.result_types);
+		{
+			lock_guard<mutex> guard(gstate.lock);
+			auto &transaction = TeradataTransaction::Get(context.client, catalog);
+			state.arena.Reset();
+			transaction.GetConnectionWithoutTransaction().QueryEach(sql, state.keys, state.arena, state.writers,
+			                                                        *state.result);
+		}
+		state.result->InitializeScan(state.scan_state);
+	}
+
+	state.result_chunk.Reset();
+	if (!state.result->Scan(state.scan_state, state.result_chunk)) {
+		// Done with this input chunk
+		state.result.reset();
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	// Combine the input rows with the rows found for them
+	const auto count = state.result_chunk.size();
+	const auto row_indices = FlatVector::GetData<uint32_t>(state.result_chunk.data[0]);
+
+	SelectionVector sel(count);
+	for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+		sel.set_index(row_idx, row_indices[row_idx]);
+	}
+
+	const auto input_count = input.ColumnCount();
+	for (idx_t col_idx = 0; col_idx < input_count; col_idx++) {
+		chunk.data[col_idx].Slice(input.data[col_idx], sel, count);
+	}
+	for (idx_t col_idx = 0; col_idx < fetch_types.size(); col_idx++) {
+		chunk.data[input_count + col_idx].Reference(state.result_chunk.data[col_idx + 1]);
+	}
+	chunk.SetCardinality(count);
+
+	return OperatorResultType::HAVE_MORE_OUTPUT;
+}
+
+string PhysicalTeradataIndexJoin::GetName() const {
+	return "TERADATA_INDEX_JOIN";
+}
+
+InsertionOrderPreservingMap<string> PhysicalTeradataIndexJoin::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	result["Table Name"] = table_name;
+	return result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Logical Operator
+//----------------------------------------------------------------------------------------------------------------------
+LogicalTeradataIndexJoin::LogicalTeradataIndexJoin(idx_t table_index, TeradataCatalog &catalog, string table_name,
+                                                   string sql, vector<idx_t> key_columns,
+                                                   vector<LogicalType> fetch_types)
+    : table_index(table_index), catalog(catalog), table_name(std::move(table_name)), sql(std::move(sql)),
+      key_columns(std::move(key_columns)), fetch_types(std::move(fetch_types)) {
+}
+
+PhysicalOperator &LogicalTeradataIndexJoin::CreatePlan(ClientContext &context, PhysicalPlanGenerator &planner) {
+	auto &child = planner.CreatePlan(*children[0]);
+	auto &result = planner.Make<PhysicalTeradataIndexJoin>(types, estimated_cardinality, catalog, table_name, sql,
+	                                                       key_columns, fetch_types);
+	result.children.push_back(child);
+	return result;
+}
+
+vector<ColumnBinding> LogicalTeradataIndexJoin::GetColumnBindings() {
+	// The input columns, followed by the columns fetched from Teradata
+	auto result = children[0]->GetColumnBindings();
+	for (idx_t col_idx = 0; col_idx < fetch_types.size(); col_idx++) {
+		result.emplace_back(table_index, col_idx);
+	}
+	return result;
+}
+
+void LogicalTeradataIndexJoin::ResolveTypes() {
+	types = children[0]->types;
+	types.insert(types.end(), fetch_types.begin(), fetch_types.end());
+}
+
+} // namespace duckdb
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "teradata_type.hpp"
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/operator/logical_extension_operator.hpp"
+
+namespace duckdb {
+
+class TeradataCatalog;
+
+//----------------------------------------------------------------------------------------------------------------------
+// Physical Operator
+//----------------------------------------------------------------------------------------------------------------------
+// Index nested loop join against a Teradata table. For every input chunk, the join keys are sent to Teradata as a
+// single USING data array request, executing a primary index lookup per input row. The input rows are then combined
+// with the rows returned for them.
+class PhysicalTeradataIndexJoin final : public PhysicalOperator {
+public:
+	PhysicalTeradataIndexJoin(PhysicalPlan &plan, vector<LogicalType> types, idx_t estimated_cardinality,
+	                          TeradataCatalog &catalog, string table_name, string sql, vector<idx_t> key_columns,
+	                          vector<LogicalType> fetch_types);
+
+	TeradataCatalog &catalog;
+	//! The name of the Teradata table we look up rows in
+	string table_name;
+	//! The parameterized lookup query
+	string sql;
+	//! The input columns passed as parameters to the lookup query
+	vector<idx_t> key_columns;
+	//! The types of the columns fetched from Teradata
+	vector<LogicalType> fetch_types;
+
+public:
+	unique_ptr<GlobalOperatorState> GetGlobalOperatorState(ClientContext &context) const override;
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                           GlobalOperatorState &gstate, OperatorState &state) const override;
+
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+	string GetName() const override;
+	InsertionOrderPreservingMap<string> ParamsToString() const override;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+// Logical Operator
+//----------------------------------------------------------------------------------------------------------------------
+class LogicalTeradataIndexJoin final : public LogicalExtensionOperator {
+public:
+	LogicalTeradataIndexJoin(idx_t table_index, TeradataCatalog &catalog, string table_name, string sql,
+	                         vector<idx_t> key_columns, vector<LogicalType> fetch_types);
+
+	//! The table index of the columns fetched from Teradata
+	idx_t table_index;
+	TeradataCatalog &catalog;
+	string table_name;
+	string sql;
+	vector<idx_t> key_columns;
+	vector<LogicalType> fetch_types;
+
+public:
+	PhysicalOperator &CreatePlan(ClientContext &context, PhysicalPlanGenerator &planner) override;
+	vector<ColumnBinding> GetColumnBindings() override;
+
+	void Serialize(Serializer &serializer) const override {
+		throw NotImplementedException("Cannot serialize TeradataIndexJoin operator");
+	}
+
+protected:
+	void ResolveTypes() override;
+};
+
+} // namespace duckdb
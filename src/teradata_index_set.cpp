@@ -61,20 +61,36 @@ optional_ptr<CatalogEntry> TeradataIndexSet::CreateIndex(ClientContext &context,
 	return CreateEntry(std::move(index_entry));
 }
 
+string TeradataIndexSet::GetIndexQuery(const string &schema_name) {
+	return StringUtil::Format("SELECT T.TableName, I.IndexName, I.IndexType, I.ColumnName, I.UniqueFlag "
+	                          "FROM DBC.IndicesV AS I JOIN DBC.TablesV AS T "
+	                          "ON T.TableName = I.TableName AND T.DatabaseName = I.DatabaseName "
+	                          "WHERE T.DatabaseName = '%s' AND (T.TableKind = 'T' OR T.TableKind = 'O') "
+	                          "ORDER BY T.TableName, I.IndexName, I.IndexType, I.ColumnName, I.UniqueFlag;",
+	                          schema_name);
+}
+
+void TeradataIndexSet::SetPrefetchedIndexes(unique_ptr<TeradataQueryResult> result) {
+	prefetched_indexes = std::move(result);
+}
+
 void TeradataIndexSet::LoadEntries(ClientContext &context) {
-	const auto &td_catalog = catalog.Cast<TeradataCatalog>();
-	auto &conn = td_catalog.GetConnection();
+	// Only use a prefetched result once, reloading the entries has to go to Teradata again
+	if (prefetched_indexes) {
+		const auto result = std::move(prefetched_indexes);
+		CreateIndexEntries(*result);
+		return;
+	}
 
-	const auto query = StringUtil::Format("SELECT T.TableName, I.IndexName, I.IndexType, I.ColumnName, I.UniqueFlag "
-	                                      "FROM DBC.IndicesV AS I JOIN DBC.TablesV AS T "
-	                                      "ON T.TableName = I.TableName AND T.DatabaseName = I.DatabaseName "
-	                                      "WHERE T.DatabaseName = '%s' AND (T.TableKind = 'T' OR T.TableKind = 'O') "
-	                                      "ORDER BY T.TableName, I.IndexName, I.IndexType, I.ColumnName, I.UniqueFlag;",
-	                                      schema.name);
+	const auto &td_catalog = catalog.Cast<TeradataCatalog>();
+	auto &conn = td_catalog.GetMetadataConnection();
 
-	const auto result = conn.Query(query, false);
+	const auto result = conn.Query(GetIndexQuery(schema.name), false);
+	CreateIndexEntries(*result);
+}
 
-	for (auto &chunk : result->Chunks()) {
+void TeradataIndexSet::CreateIndexEntries(TeradataQueryResult &result) {
+	for (auto &chunk : result.Chunks()) {
 		chunk.Flatten();
 
 		const auto count = chunk.size();
@@ -93,16 +109,22 @@ void TeradataIndexSet::LoadEntries(ClientContext &context) {
 
 		for (idx_t row_idx = 0; row_idx < count; row_idx++) {
 
+			const auto tbl_name = tbl_names[row_idx].GetString();
+			const auto idx_type = idx_types[row_idx].GetString(); // TODO: Parse this
+			const auto col_name = col_names[row_idx].GetString();
+
+			// 'P' is a nonpartitioned primary index, 'Q' a partitioned primary index
+			if (idx_type == "P" || idx_type == "Q") {
+				lock_guard<mutex> guard(primary_index_lock);
+				primary_indexes[tbl_name].push_back(col_name);
+			}
+
 			// TODO: Come up with a temp name if the index name is empty?
 			if (FlatVector::IsNull(idx_name_vec, row_idx)) {
 				continue;
-				;
 			}
 
 			auto idx_name = idx_names[row_idx].GetString();
-			const auto tbl_name = tbl_names[row_idx].GetString();
-			const auto idx_type = idx_types[row_idx].GetString(); // TODO: Parse this
-			const auto col_name = col_names[row_idx].GetString();
 
 			auto idx_flag = IndexConstraintType::NONE;
 			if (idx_flags[row_idx].GetData()[0] == 'Y') {
@@ -125,4 +147,31 @@ void TeradataIndexSet::LoadEntries(ClientContext &context) {
 	}
 }
 
-} // namespace duckdb
\ No newline at end of file
+vector<string> TeradataIndexSet::GetPrimaryIndex(ClientContext &context, const string &table_name) {
+	TryLoadEntries(context);
+
+	lock_guard<mutex> guard(primary_index_lock);
+	const auto entry = primary_indexes.find(table_name);
+	if (entry == primary_indexes.end()) {
+		return vector<string>();
+	}
+	return entry->second;
+}
+
+void TeradataIndexSet::ClearEntries() {
+	{
+		lock_guard<mutex> guard(primary_index_lock);
+		primary_indexes.clear();
+	}
+	TeradataInSchemaSet::ClearEntries();
+}
+
+void TeradataIndexSet::RefreshEntries(ClientContext &context) {
+	{
+		lock_guard<mutex> guard(primary_index_lock);
+		primary_indexes.clear();
+	}
+	TeradataInSchemaSet::RefreshEntries(context);
+}
+
+} // namespace duckdb
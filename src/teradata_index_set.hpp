@@ -2,6 +2,7 @@
 
 #include "teradata_catalog_set.hpp"
 #include "teradata_index_entry.hpp"
+#include "teradata_result.hpp"
 
 namespace duckdb {
 
@@ -15,8 +16,32 @@ public:
 public:
 	optional_ptr<CatalogEntry> CreateIndex(ClientContext &context, CreateIndexInfo &info, TableCatalogEntry &table);
 
+	// Get the columns of the primary index of a table, empty if the table has no primary index (NoPI)
+	vector<string> GetPrimaryIndex(ClientContext &context, const string &table_name);
+
+	void ClearEntries() override;
+
+	// The query listing the indexes of the tables in a schema
+	static string GetIndexQuery(const string &schema_name);
+
+	// Hand over the result of the index query, fetched along with other metadata in the same request, to be used
+	// instead of querying the indexes when the entries are loaded
+	void SetPrefetchedIndexes(unique_ptr<TeradataQueryResult> result);
+
 protected:
 	void LoadEntries(ClientContext &context) override;
+	void RefreshEntries(ClientContext &context) override;
+
+private:
+	void CreateIndexEntries(TeradataQueryResult &result);
+
+	// The prefetched result of the index query, if any
+	unique_ptr<TeradataQueryResult> prefetched_indexes;
+
+	// Primary indexes are usually unnamed, so we can't expose them as index entries.
+	// Instead, keep track of their columns per table.
+	mutex primary_index_lock;
+	case_insensitive_map_t<vector<string>> primary_indexes;
 };
 
 } // namespace duckdb
\ No newline at end of file
@@ -3,13 +3,18 @@
 
 #include "teradata_table_entry.hpp"
 #include "teradata_transaction.hpp"
+#include "teradata_connection.hpp"
 #include "teradata_request.hpp"
 #include "teradata_query.hpp"
+#include "teradata_schema_entry.hpp"
+#include "teradata_expression.hpp"
 
 #include "duckdb/parser/statement/insert_statement.hpp"
 #include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
 #include "duckdb/planner/operator/logical_insert.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/common/atomic.hpp"
 
 #include <teradata_column_writer.hpp>
 #include <duckdb/planner/operator/logical_create_table.hpp>
@@ -47,13 +52,27 @@ public:
 	ArenaAllocator arena;
 	vector<unique_ptr<TeradataColumnWriter>> writers;
 
+	// With the staging insert method, the rows are inserted into a volatile NoPI table first, and moved into the target
+	// table with a single INSERT SELECT in Finalize
+	string stage_sql;
+	string stage_insert_sql;
+
+	// With a commit interval, the rows are inserted over a dedicated session instead, in transactions of their own
+	idx_t commit_interval = 0;
+	unique_ptr<TeradataConnection> commit_conn;
+	// The number of rows committed so far, and inserted since the last commit
+	idx_t committed_count = 0;
+	idx_t uncommitted_count = 0;
+	// The table to record the number of committed rows in, within the same transactions, if any
+	string restart_table_sql;
+
 	explicit TeradataInsertGlobalState(ClientContext &context) : arena(BufferAllocator::Get(context)) {
 	}
 };
 
-static string GetInsertSQL(const TeradataInsert &insert, const TeradataTableEntry &entry) {
-
-	// First, figure out what columns we are inserting
+// The columns we are inserting, in the order of the inserted chunks
+static vector<reference<const ColumnDefinition>> GetInsertColumns(const TeradataInsert &insert,
+                                                                  const TeradataTableEntry &entry) {
 	auto &columns = entry.GetColumns();
 	idx_t column_count = columns.LogicalColumnCount();
 	vector<PhysicalIndex> column_indices;
@@ -77,18 +96,32 @@ static string GetInsertSQL(const TeradataInsert &insert, const TeradataTableEntr
 		}
 	}
 
-	// Now construct the SQL string.
-	// We first construct the USING descriptor with the column names and types so that we can pass parameters.
-	// Then we construct the INSERT INTO statement and the VALUES clause with the parameter names.
+	vector<reference<const ColumnDefinition>> result;
+	for (idx_t i = 0; i < column_count; i++) {
+		result.push_back(columns.GetColumn(column_indices[i]));
+	}
+	return result;
+}
+
+static string GetTableSQL(const TeradataTableEntry &entry) {
+	string result;
+	if (!entry.schema.name.empty()) {
+		result += KeywordHelper::WriteQuoted(entry.schema.name, '"') + ".";
+	}
+	result += KeywordHelper::WriteQuoted(entry.name, '"');
+	return result;
+}
 
+// The USING descriptor with the column names and types, so that we can pass the rows as parameters
+static string GetUsingSQL(const vector<reference<const ColumnDefinition>> &columns) {
 	string result = "USING ";
 	result += "(";
-	for (idx_t i = 0; i < column_count; i++) {
+	for (idx_t i = 0; i < columns.size(); i++) {
 		if (i > 0) {
 			result += ", ";
 		}
 
-		auto &col = columns.GetColumn(column_indices[i]);
+		auto &col = columns[i].get();
 		result += KeywordHelper::WriteQuoted(col.GetName(), '"');
 		result += " ";
 
@@ -97,27 +130,148 @@ static string GetInsertSQL(const TeradataInsert &insert, const TeradataTableEntr
 		result += td_type.ToString();
 	}
 	result += ") ";
+	return result;
+}
 
-	result += "INSERT INTO ";
+// The references to the parameters of the USING descriptor
+static string GetParameterListSQL(const vector<reference<const ColumnDefinition>> &columns) {
+	vector<string> params;
+	for (auto &col : columns) {
+		params.push_back(":" + KeywordHelper::WriteQuoted(col.get().GetName(), '"'));
+	}
+	return StringUtil::Join(params, ", ");
+}
 
-	if (!entry.schema.name.empty()) {
-		result += KeywordHelper::WriteQuoted(entry.schema.name, '"') + ".";
+static string GetInsertSQL(const vector<reference<const ColumnDefinition>> &columns, const string &table_sql) {
+	// Now construct the SQL string.
+	// We first construct the USING descriptor with the column names and types so that we can pass parameters.
+	// Then we construct the INSERT INTO statement and the VALUES clause with the parameter names.
+	return GetUsingSQL(columns) + "INSERT INTO " + table_sql + " VALUES (" + GetParameterListSQL(columns) + ");";
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Upsert
+//----------------------------------------------------------------------------------------------------------------------
+// INSERT ... ON CONFLICT is executed as a MERGE of the rows passed as parameters. Rows matching an existing row on the
+// conflict columns update it (or are skipped), the other rows are inserted. Teradata requires the ON clause of a MERGE
+// to match the primary index of the target table.
+static string GetMergeSQL(const vector<reference<const ColumnDefinition>> &columns, const string &table_sql,
+                          const vector<string> &conflict_columns, const string &update_set_sql) {
+	vector<string> names;
+	vector<string> source_columns;
+	for (auto &col : columns) {
+		auto name = KeywordHelper::WriteQuoted(col.get().GetName(), '"');
+		source_columns.push_back("s." + name);
+		names.push_back(std::move(name));
 	}
-	result += KeywordHelper::WriteQuoted(entry.name, '"');
+	const auto column_list = StringUtil::Join(names, ", ");
 
-	result += " VALUES (";
+	vector<string> conditions;
+	for (auto &col : conflict_columns) {
+		const auto name = KeywordHelper::WriteQuoted(col, '"');
+		conditions.push_back("t." + name + " = s." + name);
+	}
 
-	for (idx_t i = 0; i < column_count; i++) {
-		if (i > 0) {
-			result += ", ";
-		}
-		auto &col = columns.GetColumn(column_indices[i]);
-		result += ":" + KeywordHelper::WriteQuoted(col.GetName(), '"');
+	auto result = GetUsingSQL(columns);
+	result += StringUtil::Format("MERGE INTO %s AS t USING VALUES (%s) AS s (%s) ON %s", table_sql,
+	                             GetParameterListSQL(columns), column_list, StringUtil::Join(conditions, " AND "));
+	if (!update_set_sql.empty()) {
+		result += " WHEN MATCHED THEN UPDATE SET " + update_set_sql;
 	}
-	result += ");";
+	result += StringUtil::Format(" WHEN NOT MATCHED THEN INSERT (%s) VALUES (%s);", column_list,
+	                             StringUtil::Join(source_columns, ", "));
 	return result;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// Settings
+//----------------------------------------------------------------------------------------------------------------------
+static string GetInsertMethod(ClientContext &context) {
+	string insert_method = "direct";
+	Value insert_method_value;
+	if (context.TryGetCurrentSetting("teradata_insert_method", insert_method_value)) {
+		insert_method = StringUtil::Lower(insert_method_value.ToString());
+	}
+	if (insert_method != "direct" && insert_method != "staging") {
+		throw InvalidInputException("Unsupported teradata_insert_method '%s', expected 'direct' or 'staging'",
+		                            insert_method);
+	}
+	return insert_method;
+}
+
+static idx_t GetCommitInterval(ClientContext &context) {
+	Value commit_interval;
+	if (context.TryGetCurrentSetting("teradata_insert_commit_interval", commit_interval)) {
+		return commit_interval.GetValue<idx_t>();
+	}
+	return 0;
+}
+
+static string GetRestartTable(ClientContext &context) {
+	Value restart_table;
+	if (context.TryGetCurrentSetting("teradata_insert_restart_table", restart_table) && !restart_table.IsNull()) {
+		return restart_table.ToString();
+	}
+	return string();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Restart Table
+//----------------------------------------------------------------------------------------------------------------------
+// When committing in intervals, the number of rows committed so far is recorded per target table, within the same
+// transactions that commit the rows, so that a failed load can be resumed from the recorded row
+
+static void CreateRestartTable(TeradataConnection &conn, const TeradataTableEntry &table, const string &restart_table,
+                               const string &restart_table_sql) {
+	const auto exists_sql = StringUtil::Format("SELECT 1 FROM DBC.TablesV WHERE DatabaseName = %s AND TableName = %s;",
+	                                           KeywordHelper::WriteQuoted(table.schema.name, '\''),
+	                                           KeywordHelper::WriteQuoted(restart_table, '\''));
+	auto result = conn.Query(exists_sql, true);
+	for (auto &chunk : result->Chunks()) {
+		if (chunk.size() > 0) {
+			return;
+		}
+	}
+	conn.Execute(StringUtil::Format("CREATE TABLE %s (table_name VARCHAR(300) CHARACTER SET UNICODE NOT NULL, "
+	                                "committed_rows BIGINT NOT NULL, committed_at TIMESTAMP(0) NOT NULL) "
+	                                "UNIQUE PRIMARY INDEX (table_name);",
+	                                restart_table_sql));
+}
+
+// Upsert the number of committed rows of the target table
+static void RecordCommittedRows(TeradataConnection &conn, const TeradataInsertGlobalState &state, idx_t count) {
+	const auto table_name = KeywordHelper::WriteQuoted(state.table->schema.name + "." + state.table->name, '\'');
+	conn.Execute(StringUtil::Format(
+	    "UPDATE %s SET committed_rows = %llu, committed_at = CURRENT_TIMESTAMP(0) WHERE table_name = %s "
+	    "ELSE INSERT INTO %s (table_name, committed_rows, committed_at) VALUES (%s, %llu, CURRENT_TIMESTAMP(0));",
+	    state.restart_table_sql, count, table_name, state.restart_table_sql, table_name, count));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Staging
+//----------------------------------------------------------------------------------------------------------------------
+// Volatile tables are local to the session, but a session may stage multiple inserts within the same transaction
+static atomic<idx_t> stage_counter {0};
+
+static string GetColumnListSQL(const vector<reference<const ColumnDefinition>> &columns) {
+	vector<string> names;
+	for (auto &col : columns) {
+		names.push_back(KeywordHelper::WriteQuoted(col.get().GetName(), '"'));
+	}
+	return StringUtil::Join(names, ", ");
+}
+
+static string GetCreateStageSQL(const vector<reference<const ColumnDefinition>> &columns, const string &table_sql,
+                                const string &stage_sql) {
+	// Copy the column definitions from the target table, so that the staging table has the exact same types (lengths,
+	// character sets and precisions) instead of the widest types the DuckDB types map to, which would quickly exceed
+	// the maximum row length. Without a primary index, rows are appended to the table on the AMP that receives them,
+	// instead of being redistributed and sorted by the hash of their primary index as they arrive.
+	return StringUtil::Format("CREATE MULTISET VOLATILE TABLE %s AS (SELECT %s FROM %s) WITH NO DATA NO PRIMARY INDEX "
+	                          "ON COMMIT PRESERVE ROWS;",
+	                          stage_sql, GetColumnListSQL(columns), table_sql);
+}
+
 unique_ptr<GlobalSinkState> TeradataInsert::GetGlobalSinkState(ClientContext &context) const {
 
 	// If no table supplied, this is a CTAS
@@ -136,7 +290,64 @@ unique_ptr<GlobalSinkState> TeradataInsert::GetGlobalSinkState(ClientContext &co
 	auto result = make_uniq<TeradataInsertGlobalState>(context);
 	result->table = insert_table;
 	result->insert_count = 0;
-	result->insert_sql = GetInsertSQL(*this, *insert_table);
+
+	const auto columns = GetInsertColumns(*this, *insert_table);
+	const auto table_sql = GetTableSQL(*insert_table);
+	result->insert_sql = conflict_columns.empty()
+	                         ? GetInsertSQL(columns, table_sql)
+	                         : GetMergeSQL(columns, table_sql, conflict_columns, update_set_sql);
+
+	const auto insert_method = GetInsertMethod(context);
+	result->commit_interval = GetCommitInterval(context);
+	if (result->commit_interval > 0 && insert_method == "staging") {
+		// The staged rows are only moved into the table at the end, by a single statement
+		throw InvalidInputException("teradata_insert_commit_interval can not be used with the 'staging' "
+		                            "teradata_insert_method");
+	}
+	if (result->commit_interval > 0) {
+		// The dedicated session would wait for the locks held by our own transaction
+		auto &transaction = TeradataTransaction::Get(context, insert_table->catalog);
+		if (transaction.HasStarted()) {
+			throw InvalidInputException("teradata_insert_commit_interval can not be used in an explicit transaction, "
+			                            "or in one that has already modified Teradata");
+		}
+		result->commit_conn = insert_table->catalog.Cast<TeradataCatalog>().OpenConnection();
+
+		const auto restart_table = GetRestartTable(context);
+		if (!restart_table.empty()) {
+			// The restart table is created by its own implicit transaction, before any rows are inserted, and starts
+			// over from zero rows for every load
+			result->restart_table_sql = KeywordHelper::WriteQuoted(insert_table->schema.name, '"') + "." +
+			                            KeywordHelper::WriteQuoted(restart_table, '"');
+			CreateRestartTable(*result->commit_conn, *insert_table, restart_table, result->restart_table_sql);
+			RecordCommittedRows(*result->commit_conn, *result, 0);
+		}
+	}
+
+	// The staging table has to be created before the transaction starts, Teradata only allows DDL as the last statement
+	// of a transaction. Upserts are merged row by row, which the staging table would not help with.
+	auto &transaction = TeradataTransaction::Get(context, insert_table->catalog);
+	if (insert_method == "staging") {
+		if (!conflict_columns.empty()) {
+			throw InvalidInputException("The 'staging' teradata_insert_method can not be used with ON CONFLICT or "
+			                            "INSERT OR REPLACE, set teradata_insert_method to 'direct' instead");
+		}
+		if (transaction.HasStarted()) {
+			throw InvalidInputException("The 'staging' teradata_insert_method can not be used in an explicit "
+			                            "transaction, or in one that has already modified Teradata, as Teradata only "
+			                            "allows creating the staging table before the transaction has started");
+		}
+		auto &conn = transaction.GetConnectionWithoutTransaction();
+
+		result->stage_sql = KeywordHelper::WriteQuoted("duckdb_insert_stage_" + to_string(++stage_counter), '"');
+		conn.Execute(GetCreateStageSQL(columns, table_sql, result->stage_sql));
+		transaction.AddCleanup("DROP TABLE " + result->stage_sql + ";");
+
+		const auto column_list = GetColumnListSQL(columns);
+		result->stage_insert_sql = StringUtil::Format("INSERT INTO %s (%s) SELECT %s FROM %s;", table_sql, column_list,
+		                                              column_list, result->stage_sql);
+		result->insert_sql = GetInsertSQL(columns, result->stage_sql);
+	}
 
 	const auto table_types = insert_table->GetTypes();
 	result->writers.reserve(table_types.size());
@@ -151,12 +362,52 @@ unique_ptr<GlobalSinkState> TeradataInsert::GetGlobalSinkState(ClientContext &co
 //----------------------------------------------------------------------------------------------------------------------
 // Sink
 //----------------------------------------------------------------------------------------------------------------------
+static void CommitInsert(TeradataInsertGlobalState &state) {
+	if (!state.restart_table_sql.empty()) {
+		RecordCommittedRows(*state.commit_conn, state, state.committed_count + state.uncommitted_count);
+	}
+	state.commit_conn->Execute("END TRANSACTION;");
+	state.committed_count += state.uncommitted_count;
+	state.uncommitted_count = 0;
+}
+
+static void InsertAndCommit(TeradataInsertGlobalState &state, DataChunk &chunk) {
+	auto &conn = *state.commit_conn;
+	try {
+		if (state.uncommitted_count == 0) {
+			conn.Execute("BEGIN TRANSACTION;");
+		}
+
+		state.arena.Reset();
+		conn.Execute(state.insert_sql, chunk, state.arena, state.writers);
+		state.uncommitted_count += chunk.size();
+
+		if (state.uncommitted_count >= state.commit_interval) {
+			CommitInsert(state);
+		}
+	} catch (std::exception &ex) {
+		// Teradata rolls back the failed transaction, but the rows committed before it stay. Report how many, so that
+		// the load can be restarted from there.
+		ErrorData error(ex);
+		throw IOException("Insert into Teradata table \"%s\" failed after committing %llu rows: %s", state.table->name,
+		                  state.committed_count, error.RawMessage());
+	}
+}
+
 SinkResultType TeradataInsert::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 
 	// Sink into the Teradata table
 	auto &state = sink_state->Cast<TeradataInsertGlobalState>();
+	if (state.commit_conn) {
+		InsertAndCommit(state, chunk);
+		state.insert_count += chunk.size();
+		return SinkResultType::NEED_MORE_INPUT;
+	}
+
 	auto &transaction = TeradataTransaction::Get(context.client, state.table->catalog);
-	auto &conn = transaction.GetConnection();
+	// Appending to the staging table does not need to take part in the transaction, it is only moved into the target
+	// table (within the transaction) once all rows have been staged
+	auto &conn = state.stage_sql.empty() ? transaction.GetConnection() : transaction.GetConnectionWithoutTransaction();
 
 	// Reset the arena before executing the query
 	state.arena.Reset();
@@ -173,6 +424,16 @@ SinkResultType TeradataInsert::Sink(ExecutionContext &context, DataChunk &chunk,
 //----------------------------------------------------------------------------------------------------------------------
 SinkFinalizeType TeradataInsert::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                           OperatorSinkFinalizeInput &input) const {
+	auto &state = input.global_state.Cast<TeradataInsertGlobalState>();
+	if (state.commit_conn && state.uncommitted_count > 0) {
+		CommitInsert(state);
+	}
+	if (!state.stage_sql.empty() && state.insert_count > 0) {
+		// Move all staged rows into the target table at once, the staging table is dropped when the transaction ends
+		auto &transaction = TeradataTransaction::Get(context, state.table->catalog);
+		auto &conn = transaction.GetConnection();
+		conn.Execute(state.stage_insert_sql);
+	}
 	return SinkFinalizeType::READY;
 }
 
@@ -208,7 +469,8 @@ InsertionOrderPreservingMap<string> TeradataInsert::ParamsToString() const {
 // Plan
 //----------------------------------------------------------------------------------------------------------------------
 
-static void MaterializeTeradataScans(PhysicalOperator &op) {
+// The scans of the database that is inserted into are read within its transaction, if given
+static void MaterializeTeradataScans(PhysicalOperator &op, optional_ptr<TeradataCatalog> transaction_catalog) {
 	if (op.type == PhysicalOperatorType::TABLE_SCAN) {
 		auto &table_scan = op.Cast<PhysicalTableScan>();
 		if (TeradataCatalog::IsTeradataScan(table_scan.function.name)) {
@@ -216,27 +478,143 @@ static void MaterializeTeradataScans(PhysicalOperator &op) {
 
 			// If we are inserting into Teradata, materialize the all td-scans in this part of the plan
 			bind_data.is_materialized = true;
+			if (transaction_catalog && bind_data.GetCatalog().get() == transaction_catalog.get()) {
+				bind_data.read_in_transaction = true;
+			}
 		}
 	}
 
 	for (auto &child : op.children) {
-		MaterializeTeradataScans(child);
+		MaterializeTeradataScans(child, transaction_catalog);
 	}
 }
 
+// Translate the ON CONFLICT clause into the conflict columns and SET clause of the MERGE to upsert the rows with
+static void PlanOnConflict(ClientContext &context, LogicalInsert &op, TeradataInsert &insert) {
+	auto &info = op.on_conflict_info;
+	if (info.on_conflict_condition) {
+		throw BinderException("ON CONFLICT with a WHERE clause on the conflict target is not supported for insertion "
+		                      "into Teradata tables");
+	}
+	if (info.do_update_condition) {
+		throw BinderException("ON CONFLICT DO UPDATE with a WHERE clause is not supported for insertion into Teradata "
+		                      "tables");
+	}
+
+	auto &table = op.table;
+	auto &columns = table.GetColumns();
+
+	// Teradata requires the ON clause of a MERGE to match on the primary index of the target table, which is
+	// therefore used if no conflict target is given
+	auto primary_index = table.schema.Cast<TeradataSchemaEntry>().GetPrimaryIndex(context, table.name);
+	if (primary_index.empty()) {
+		throw BinderException("ON CONFLICT requires the Teradata table \"%s\" to have a primary index", table.name);
+	}
+	if (info.on_conflict_filter.empty()) {
+		insert.conflict_columns = std::move(primary_index);
+	} else {
+		vector<column_t> conflict_ids(info.on_conflict_filter.begin(), info.on_conflict_filter.end());
+		std::sort(conflict_ids.begin(), conflict_ids.end());
+		for (auto &col_id : conflict_ids) {
+			insert.conflict_columns.push_back(columns.GetColumn(PhysicalIndex(col_id)).GetName());
+		}
+		const case_insensitive_set_t target_set(insert.conflict_columns.begin(), insert.conflict_columns.end());
+		const case_insensitive_set_t index_set(primary_index.begin(), primary_index.end());
+		bool matches_index = target_set.size() == index_set.size();
+		for (auto &col : index_set) {
+			matches_index = matches_index && target_set.find(col) != target_set.end();
+		}
+		if (!matches_index) {
+			throw BinderException("ON CONFLICT: the conflict target (%s) has to be the primary index (%s) of the "
+			                      "Teradata table \"%s\", as Teradata only merges rows on the primary index",
+			                      StringUtil::Join(insert.conflict_columns, ", "),
+			                      StringUtil::Join(primary_index, ", "), table.name);
+		}
+	}
+
+	// The source rows of the MERGE only contain the inserted columns
+	case_insensitive_set_t inserted_columns;
+	for (auto &col : columns.Physical()) {
+		if (op.column_index_map.empty() || op.column_index_map[col.Physical()] != DConstants::INVALID_INDEX) {
+			inserted_columns.insert(col.GetName());
+		}
+	}
+	for (auto &col : insert.conflict_columns) {
+		if (inserted_columns.find(col) == inserted_columns.end()) {
+			throw BinderException("ON CONFLICT: the conflict column \"%s\" has to be inserted into the Teradata table",
+			                      col);
+		}
+	}
+
+	if (info.action_type == OnConflictAction::NOTHING) {
+		return;
+	}
+
+	// The SET expressions reference the excluded row (all columns of the table), followed by the columns fetched from
+	// the existing row. These are the source and target rows of the MERGE respectively.
+	vector<string> ref_columns;
+	for (auto &col : columns.Physical()) {
+		const auto is_inserted = inserted_columns.find(col.GetName()) != inserted_columns.end();
+		ref_columns.push_back(is_inserted ? "s." + KeywordHelper::WriteQuoted(col.GetName(), '"') : string());
+	}
+	for (auto &col_id : info.columns_to_fetch) {
+		auto &col = columns.GetColumn(PhysicalIndex(col_id));
+		ref_columns.push_back("t." + KeywordHelper::WriteQuoted(col.GetName(), '"'));
+	}
+	const auto resolver = [&ref_columns](const Expression &expr, string &result) {
+		if (expr.GetExpressionClass() != ExpressionClass::BOUND_REF) {
+			return false;
+		}
+		const auto index = expr.Cast<BoundReferenceExpression>().index;
+		if (index >= ref_columns.size() || ref_columns[index].empty()) {
+			return false;
+		}
+		result = ref_columns[index];
+		return true;
+	};
+
+	const case_insensitive_set_t conflict_set(insert.conflict_columns.begin(), insert.conflict_columns.end());
+	vector<string> set_list;
+	for (idx_t i = 0; i < info.set_columns.size(); i++) {
+		auto &col = columns.GetColumn(info.set_columns[i]);
+		const auto name = KeywordHelper::WriteQuoted(col.GetName(), '"');
+
+		string value;
+		if (op.expressions[i]->type == ExpressionType::VALUE_DEFAULT) {
+			value = "DEFAULT";
+		} else if (!TeradataExpression::TryTransformValue(*op.expressions[i], resolver, value)) {
+			throw NotImplementedException("ON CONFLICT DO UPDATE: the value of column \"%s\" can not be computed by "
+			                              "Teradata",
+			                              col.GetName());
+		}
+		// The columns matched on can not be updated by a MERGE, but setting them to the same value is a no-op anyway
+		if (conflict_set.find(col.GetName()) != conflict_set.end()) {
+			if (value == "s." + name) {
+				continue;
+			}
+			throw BinderException("ON CONFLICT DO UPDATE: the conflict column \"%s\" can not be updated in a "
+			                      "Teradata table",
+			                      col.GetName());
+		}
+		set_list.push_back(name + " = " + value);
+	}
+	insert.update_set_sql = StringUtil::Join(set_list, ", ");
+}
+
 PhysicalOperator &TeradataCatalog::PlanInsert(ClientContext &context, PhysicalPlanGenerator &planner, LogicalInsert &op,
                                               optional_ptr<PhysicalOperator> plan) {
 
 	if (op.return_chunk) {
 		throw BinderException("RETURNING clause not yet supported for insertion into Teradata tables");
 	}
-	if (op.on_conflict_info.action_type != OnConflictAction::THROW) {
-		throw BinderException("ON CONFLICT clause not yet supported for insertion into Teradata tables");
-	}
-
 	D_ASSERT(plan);
 
-	MaterializeTeradataScans(*plan);
+	// An auto-commit statement only starts its Teradata transaction once it writes, so that e.g. INSERT INTO ...
+	// SELECT ... FROM another Teradata table reads and writes atomically, begin it before the rows are read instead.
+	// Committing in intervals and staging the rows both require the transaction not to have started, and do not
+	// insert atomically anyway.
+	const auto read_in_transaction = GetCommitInterval(context) == 0 && GetInsertMethod(context) != "staging";
+	MaterializeTeradataScans(*plan, read_in_transaction ? this : nullptr);
 
 	// TODO: This is where we would cast to TD types if needed
 	// plan = AddCastToTeradataTypes(context, std::move(plan));
@@ -244,6 +622,10 @@ PhysicalOperator &TeradataCatalog::PlanInsert(ClientContext &context, PhysicalPl
 	auto &insert = planner.Make<TeradataInsert>(op, op.table, op.column_index_map);
 	insert.children.push_back(*plan);
 
+	if (op.on_conflict_info.action_type != OnConflictAction::THROW) {
+		PlanOnConflict(context, op, insert);
+	}
+
 	return insert;
 }
 
@@ -253,7 +635,7 @@ PhysicalOperator &TeradataCatalog::PlanCreateTableAs(ClientContext &context, Phy
 	// TODO: This is where we would cast to TD types if needed
 	// plan = AddCastToTeradataTypes(context, std::move(plan));
 
-	MaterializeTeradataScans(plan);
+	MaterializeTeradataScans(plan, nullptr);
 
 	auto &insert = planner.Make<TeradataInsert>(op, op.schema, std::move(op.info));
 	insert.children.push_back(plan);
@@ -22,6 +22,10 @@ public:
 	unique_ptr<BoundCreateTableInfo> info;
 	//! column_index_map
 	physical_index_vector_t<idx_t> column_index_map;
+	//! ON CONFLICT: the columns to match existing rows on, the rows are upserted with a MERGE if not empty
+	vector<string> conflict_columns;
+	//! ON CONFLICT DO UPDATE: the SET clause to update matching rows with, matching rows are skipped if empty
+	string update_set_sql;
 
 public:
 	// Source interface
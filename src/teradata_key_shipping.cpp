@@ -0,0 +1,217 @@
+#include "teradata_key_shipping.hpp"
+#include "teradata_catalog.hpp"
+#include "teradata_connection.hpp"
+#include "teradata_column_writer.hpp"
+#include "teradata_transaction.hpp"
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/types/value_map.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+
+namespace duckdb {
+
+//----------------------------------------------------------------------------------------------------------------------
+// Shipped Keys
+//----------------------------------------------------------------------------------------------------------------------
+// Volatile tables are local to the session, but multiple joins of the session may ship keys at the same time
+static atomic<idx_t> shipped_keys_counter {0};
+static constexpr const char *SHIPPED_KEYS_COLUMN = "\"k\"";
+
+TeradataShippedKeys::TeradataShippedKeys(TeradataCatalog &catalog, string column_name_p, LogicalType key_type_p,
+                                         TeradataType key_td_type_p)
+    : catalog(catalog), column_name(std::move(column_name_p)), key_type(std::move(key_type_p)),
+      key_td_type(key_td_type_p) {
+}
+
+TeradataShippedKeys::~TeradataShippedKeys() {
+}
+
+void TeradataShippedKeys::Ship(ClientContext &context, ColumnDataCollection &keys) {
+	is_shipped = false;
+
+	// Once the transaction has started, creating the volatile table would have to be its last statement.
+	// The scan is not filtered by the keys then, which only costs transferring the rows that do not match.
+	auto &transaction = TeradataTransaction::Get(context, catalog);
+	if (transaction.HasStarted()) {
+		return;
+	}
+	auto &con = transaction.GetConnectionWithoutTransaction();
+
+	table_name = KeywordHelper::WriteQuoted("duckdb_shipped_keys_" + to_string(++shipped_keys_counter), '"');
+	con.Execute(StringUtil::Format("CREATE MULTISET VOLATILE TABLE %s (%s %s) PRIMARY INDEX (%s) ON COMMIT "
+	                               "PRESERVE ROWS;",
+	                               table_name, SHIPPED_KEYS_COLUMN, key_td_type.ToString(), SHIPPED_KEYS_COLUMN));
+	transaction.AddCleanup("DROP TABLE " + table_name + ";");
+
+	const auto insert_sql =
+	    StringUtil::Format("USING (%s %s) INSERT INTO %s VALUES (:%s);", SHIPPED_KEYS_COLUMN,
+	                       TeradataType::FromDuckDB(key_type).ToString(), table_name, SHIPPED_KEYS_COLUMN);
+
+	ArenaAllocator arena(Allocator::DefaultAllocator());
+	vector<unique_ptr<TeradataColumnWriter>> writers;
+	writers.push_back(TeradataColumnWriter::Make(key_type));
+
+	// Insert the keys in batches, using the same parameterized insert path as regular inserts
+	for (auto &chunk : keys.Chunks()) {
+		arena.Reset();
+		con.Execute(insert_sql, chunk, arena, writers);
+	}
+
+	is_shipped = true;
+}
+
+string TeradataShippedKeys::GetFilter() const {
+	return StringUtil::Format("%s IN (SELECT %s FROM %s)", KeywordHelper::WriteQuoted(column_name, '"'),
+	                          SHIPPED_KEYS_COLUMN, table_name);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Physical Operator
+//----------------------------------------------------------------------------------------------------------------------
+PhysicalTeradataKeyShipping::PhysicalTeradataKeyShipping(PhysicalPlan &plan, vector<LogicalType> types,
+                                                         idx_t estimated_cardinality, idx_t key_index,
+                                                         shared_ptr<TeradataShippedKeys> keys)
+    : PhysicalOperator(plan, PhysicalOperatorType::EXTENSION, std::move(types), estimated_cardinality),
+      key_index(key_index), keys(std::move(keys)) {
+}
+
+class TeradataKeyShippingGlobalState final : public GlobalSinkState {
+public:
+	TeradataKeyShippingGlobalState(ClientContext &context, const vector<LogicalType> &types)
+	    : collection(context, types) {
+	}
+
+	mutex lock;
+	ColumnDataCollection collection;
+	//! The distinct non-NULL keys of the input, only these are shipped
+	value_set_t keys;
+};
+
+class TeradataKeyShippingLocalState final : public LocalSinkState {
+public:
+	TeradataKeyShippingLocalState(ClientContext &context, const vector<LogicalType> &types)
+	    : collection(context, types) {
+	}
+
+	ColumnDataCollection collection;
+	value_set_t keys;
+};
+
+class TeradataKeyShippingSourceState final : public GlobalSourceState {
+public:
+	ColumnDataScanState scan_state;
+};
+
+unique_ptr<GlobalSinkState> PhysicalTeradataKeyShipping::GetGlobalSinkState(ClientContext &context) const {
+	return make_uniq<TeradataKeyShippingGlobalState>(context, types);
+}
+
+unique_ptr<LocalSinkState> PhysicalTeradataKeyShipping::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<TeradataKeyShippingLocalState>(context.client, types);
+}
+
+SinkResultType PhysicalTeradataKeyShipping::Sink(ExecutionContext &context, DataChunk &chunk,
+                                                 OperatorSinkInput &input) const {
+	auto &state = input.local_state.Cast<TeradataKeyShippingLocalState>();
+	state.collection.Append(chunk);
+
+	// NULL keys never match in an equality join
+	auto &key_vector = chunk.data[key_index];
+	UnifiedVectorFormat key_format;
+	key_vector.ToUnifiedFormat(chunk.size(), key_format);
+
+	// The local relation is small (see teradata_key_shipping_threshold), but its keys may repeat many times
+	for (idx_t row_idx = 0; row_idx < chunk.size(); row_idx++) {
+		if (key_format.validity.RowIsValid(key_format.sel->get_index(row_idx))) {
+			state.keys.insert(key_vector.GetValue(row_idx));
+		}
+	}
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkCombineResultType PhysicalTeradataKeyShipping::Combine(ExecutionContext &context,
+                                                           OperatorSinkCombineInput &input) const {
+	auto &gstate = input.global_state.Cast<TeradataKeyShippingGlobalState>();
+	auto &lstate = input.local_state.Cast<TeradataKeyShippingLocalState>();
+
+	lock_guard<mutex> guard(gstate.lock);
+	gstate.collection.Combine(lstate.collection);
+	gstate.keys.insert(lstate.keys.begin(), lstate.keys.end());
+	return SinkCombineResultType::FINISHED;
+}
+
+SinkFinalizeType PhysicalTeradataKeyShipping::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                       OperatorSinkFinalizeInput &input) const {
+	auto &state = input.global_state.Cast<TeradataKeyShippingGlobalState>();
+
+	const auto &key_type = types[key_index];
+	ColumnDataCollection distinct_keys(context, {key_type});
+	DataChunk key_chunk;
+	key_chunk.Initialize(context, {key_type});
+	for (auto &key : state.keys) {
+		key_chunk.SetValue(0, key_chunk.size(), key);
+		key_chunk.SetCardinality(key_chunk.size() + 1);
+		if (key_chunk.size() == STANDARD_VECTOR_SIZE) {
+			distinct_keys.Append(key_chunk);
+			key_chunk.Reset();
+		}
+	}
+	if (key_chunk.size() > 0) {
+		distinct_keys.Append(key_chunk);
+	}
+	state.keys.clear();
+
+	keys->Ship(context, distinct_keys);
+	return SinkFinalizeType::READY;
+}
+
+unique_ptr<GlobalSourceState> PhysicalTeradataKeyShipping::GetGlobalSourceState(ClientContext &context) const {
+	auto &sink = sink_state->Cast<TeradataKeyShippingGlobalState>();
+	auto result = make_uniq<TeradataKeyShippingSourceState>();
+	sink.collection.InitializeScan(result->scan_state);
+	return std::move(result);
+}
+
+SourceResultType PhysicalTeradataKeyShipping::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                      OperatorSourceInput &input) const {
+	auto &sink = sink_state->Cast<TeradataKeyShippingGlobalState>();
+	auto &state = input.global_state.Cast<TeradataKeyShippingSourceState>();
+
+	sink.collection.Scan(state.scan_state, chunk);
+	return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
+}
+
+string PhysicalTeradataKeyShipping::GetName() const {
+	return "TERADATA_KEY_SHIPPING";
+}
+
+InsertionOrderPreservingMap<string> PhysicalTeradataKeyShipping::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	result["Key Column"] = keys->GetColumnName();
+	return result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Logical Operator
+//----------------------------------------------------------------------------------------------------------------------
+LogicalTeradataKeyShipping::LogicalTeradataKeyShipping(idx_t key_index, shared_ptr<TeradataShippedKeys> keys)
+    : key_index(key_index), keys(std::move(keys)) {
+}
+
+PhysicalOperator &LogicalTeradataKeyShipping::CreatePlan(ClientContext &context, PhysicalPlanGenerator &planner) {
+	auto &child = planner.CreatePlan(*children[0]);
+	auto &result = planner.Make<PhysicalTeradataKeyShipping>(types, estimated_cardinality, key_index, keys);
+	result.children.push_back(child);
+	return result;
+}
+
+vector<ColumnBinding> LogicalTeradataKeyShipping::GetColumnBindings() {
+	// We pass on our input unchanged
+	return children[0]->GetColumnBindings();
+}
+
+void LogicalTeradataKeyShipping::ResolveTypes() {
+	types = children[0]->types;
+}
+
+} // namespace duckdb
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "teradata_type.hpp"
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/operator/logical_extension_operator.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+
+namespace duckdb {
+
+class TeradataCatalog;
+class TeradataConnection;
+
+//----------------------------------------------------------------------------------------------------------------------
+// Shipped Keys
+//----------------------------------------------------------------------------------------------------------------------
+// The join keys of a local relation, uploaded into a Teradata volatile table so that a Teradata scan can be filtered
+// with them. Volatile tables are only visible within the session that created them, so the keys are shipped over the
+// session of the transaction, which the filtered scan also uses.
+class TeradataShippedKeys {
+public:
+	TeradataShippedKeys(TeradataCatalog &catalog, string column_name, LogicalType key_type, TeradataType key_td_type);
+	~TeradataShippedKeys();
+
+	//! Upload the keys into a new volatile table, which is dropped once the transaction ends. The keys are not
+	//! shipped if the transaction has already started, as Teradata only allows DDL as the last statement of it.
+	void Ship(ClientContext &context, ColumnDataCollection &keys);
+	//! Whether the keys have been shipped and the scan can filter on them
+	bool IsShipped() const {
+		return is_shipped;
+	}
+	//! The predicate to add to the Teradata scan
+	string GetFilter() const;
+
+	//! The column of the Teradata scan the keys are matched against
+	const string &GetColumnName() const {
+		return column_name;
+	}
+
+private:
+	TeradataCatalog &catalog;
+	string column_name;
+	LogicalType key_type;
+	TeradataType key_td_type;
+
+	string table_name;
+	bool is_shipped = false;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+// Physical Operator
+//----------------------------------------------------------------------------------------------------------------------
+// Collects the input and its keys in parallel, ships the keys to Teradata and then passes on the input unchanged.
+class PhysicalTeradataKeyShipping final : public PhysicalOperator {
+public:
+	PhysicalTeradataKeyShipping(PhysicalPlan &plan, vector<LogicalType> types, idx_t estimated_cardinality,
+	                            idx_t key_index, shared_ptr<TeradataShippedKeys> keys);
+
+	//! The column of the input containing the keys
+	idx_t key_index;
+	//! Where to ship the keys to
+	shared_ptr<TeradataShippedKeys> keys;
+
+public:
+	// Source interface
+	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+
+	bool IsSource() const override {
+		return true;
+	}
+
+public:
+	// Sink interface
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          OperatorSinkFinalizeInput &input) const override;
+
+	bool IsSink() const override {
+		return true;
+	}
+
+	bool ParallelSink() const override {
+		return true;
+	}
+
+	string GetName() const override;
+	InsertionOrderPreservingMap<string> ParamsToString() const override;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+// Logical Operator
+//----------------------------------------------------------------------------------------------------------------------
+class LogicalTeradataKeyShipping final : public LogicalExtensionOperator {
+public:
+	LogicalTeradataKeyShipping(idx_t key_index, shared_ptr<TeradataShippedKeys> keys);
+
+	idx_t key_index;
+	shared_ptr<TeradataShippedKeys> keys;
+
+public:
+	PhysicalOperator &CreatePlan(ClientContext &context, PhysicalPlanGenerator &planner) override;
+	vector<ColumnBinding> GetColumnBindings() override;
+
+	void Serialize(Serializer &serializer) const override {
+		throw NotImplementedException("Cannot serialize TeradataKeyShipping operator");
+	}
+
+protected:
+	void ResolveTypes() override;
+};
+
+} // namespace duckdb
@@ -0,0 +1,623 @@
+#include "teradata_optimizer.hpp"
+#include "teradata_catalog.hpp"
+#include "teradata_query.hpp"
+#include "teradata_filter.hpp"
+#include "teradata_parameters.hpp"
+#include "teradata_key_shipping.hpp"
+#include "teradata_index_join.hpp"
+#include "teradata_schema_entry.hpp"
+#include "teradata_table_entry.hpp"
+
+#include "duckdb/main/config.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/optimizer/column_binding_replacer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+
+namespace duckdb {
+
+//----------------------------------------------------------------------------------------------------------------------
+// Join Relation
+//----------------------------------------------------------------------------------------------------------------------
+// A Teradata scan participating in a join that we want to push down
+
+namespace {
+
+struct TeradataJoinRelation {
+	TeradataJoinRelation(LogicalGet &get_p, string alias_p)
+	    : get(get_p), bind_data(get_p.bind_data->Cast<TeradataBindData>()), alias(std::move(alias_p)) {
+	}
+
+	LogicalGet &get;
+	TeradataBindData &bind_data;
+	string alias;
+
+	bool Contains(const ColumnBinding &binding) const {
+		return binding.table_index == get.table_index;
+	}
+
+	idx_t GetColumnIndex(const ColumnBinding &binding) const {
+		return get.GetColumnIds()[binding.column_index].GetPrimaryIndex();
+	}
+
+	string GetColumnSQL(const ColumnBinding &binding) const {
+		return alias + "." + KeywordHelper::WriteQuoted(bind_data.names[GetColumnIndex(binding)], '"');
+	}
+
+	string GetSourceSQL() const {
+		return bind_data.GetSourceSQL(alias);
+	}
+
+	string GetFilterSQL() const {
+		vector<column_t> column_ids;
+		for (auto &col : get.GetColumnIds()) {
+			column_ids.push_back(col.GetPrimaryIndex());
+		}
+		return TeradataFilter::Transform(column_ids, get.table_filters, bind_data.names, alias);
+	}
+};
+
+} // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+// Join Pushdown
+//----------------------------------------------------------------------------------------------------------------------
+
+static optional_ptr<LogicalGet> GetTeradataScan(LogicalOperator &op) {
+	if (op.type != LogicalOperatorType::LOGICAL_GET) {
+		return nullptr;
+	}
+	auto &get = op.Cast<LogicalGet>();
+	if (!TeradataCatalog::IsTeradataScan(get.function.name) || !get.bind_data) {
+		return nullptr;
+	}
+	auto &bind_data = get.bind_data->Cast<TeradataBindData>();
+	if (!bind_data.GetCatalog() || get.GetColumnIds().empty()) {
+		return nullptr;
+	}
+	for (auto &col : get.GetColumnIds()) {
+		// We can only push down regular columns, not the row id or other virtual columns
+		if (col.GetPrimaryIndex() >= bind_data.names.size()) {
+			return nullptr;
+		}
+	}
+	return &get;
+}
+
+// Whether the plan scans any table of the catalog. Those scans stream their result over the session of the transaction,
+// which can not send any other request until they are done.
+static bool ScansCatalog(LogicalOperator &op, const TeradataCatalog &catalog) {
+	if (op.type == LogicalOperatorType::LOGICAL_GET) {
+		auto &get = op.Cast<LogicalGet>();
+		if (TeradataCatalog::IsTeradataScan(get.function.name) && get.bind_data &&
+		    get.bind_data->Cast<TeradataBindData>().GetCatalog().get() == &catalog) {
+			return true;
+		}
+	}
+	for (auto &child : op.children) {
+		if (ScansCatalog(*child, catalog)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool TransformJoinComparison(ExpressionType type, string &result) {
+	switch (type) {
+	case ExpressionType::COMPARE_EQUAL:
+		result = "=";
+		return true;
+	case ExpressionType::COMPARE_NOTEQUAL:
+		result = "<>";
+		return true;
+	case ExpressionType::COMPARE_LESSTHAN:
+		result = "<";
+		return true;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		result = ">";
+		return true;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		result = "<=";
+		return true;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		result = ">=";
+		return true;
+	default:
+		return false;
+	}
+}
+
+// Teradata compares strings ignoring trailing blanks, and ignoring case for NOT CASESPECIFIC columns, so a comparison
+// of strings evaluated by Teradata can match rows that are not equal in DuckDB. Joins on strings are kept local.
+static bool IsStringKey(const Expression &expr) {
+	return expr.return_type.id() == LogicalTypeId::VARCHAR;
+}
+
+static bool TransformJoinCondition(const JoinCondition &cond, const TeradataJoinRelation &left,
+                                   const TeradataJoinRelation &right, string &result) {
+	if (cond.left->type != ExpressionType::BOUND_COLUMN_REF || cond.right->type != ExpressionType::BOUND_COLUMN_REF) {
+		return false;
+	}
+	auto &left_ref = cond.left->Cast<BoundColumnRefExpression>();
+	auto &right_ref = cond.right->Cast<BoundColumnRefExpression>();
+	if (!left.Contains(left_ref.binding) || !right.Contains(right_ref.binding)) {
+		return false;
+	}
+	if (IsStringKey(*cond.left) || IsStringKey(*cond.right)) {
+		return false;
+	}
+	string op;
+	if (!TransformJoinComparison(cond.comparison, op)) {
+		return false;
+	}
+	result = left.GetColumnSQL(left_ref.binding) + " " + op + " " + right.GetColumnSQL(right_ref.binding);
+	return true;
+}
+
+static void AddCondition(string &clause, const string &condition) {
+	if (condition.empty()) {
+		return;
+	}
+	if (!clause.empty()) {
+		clause += " AND ";
+	}
+	clause += condition;
+}
+
+// Join filters referencing a scan we remove can no longer be pushed into it, so drop them
+static void RemoveJoinFilterPushdown(LogicalOperator &op, const LogicalGet &left, const LogicalGet &right) {
+	if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		auto &join = op.Cast<LogicalComparisonJoin>();
+		if (join.filter_pushdown) {
+			for (auto &target : join.filter_pushdown->probe_info) {
+				if (&target.get == &left || &target.get == &right) {
+					join.filter_pushdown.reset();
+					break;
+				}
+			}
+		}
+	}
+	for (auto &child : op.children) {
+		RemoveJoinFilterPushdown(*child, left, right);
+	}
+}
+
+static bool TryPushdownJoin(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &root,
+                            unique_ptr<LogicalOperator> &op) {
+	if (op->type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		return false;
+	}
+	auto &join = op->Cast<LogicalComparisonJoin>();
+	if (join.join_type != JoinType::INNER && join.join_type != JoinType::LEFT && join.join_type != JoinType::SEMI) {
+		return false;
+	}
+	if (join.predicate || join.conditions.empty()) {
+		return false;
+	}
+
+	auto left_get = GetTeradataScan(*join.children[0]);
+	auto right_get = GetTeradataScan(*join.children[1]);
+	if (!left_get || !right_get) {
+		return false;
+	}
+
+	const TeradataJoinRelation left(*left_get, "t0");
+	const TeradataJoinRelation right(*right_get, "t1");
+
+	auto &catalog = *left.bind_data.GetCatalog();
+	if (&catalog != right.bind_data.GetCatalog().get()) {
+		// Can only push down joins between tables of the same Teradata database
+		return false;
+	}
+	if (!left.bind_data.parameters.Empty() || !right.bind_data.parameters.Empty()) {
+		// The placeholders of parameterized queries refer to their own USING clause
+		return false;
+	}
+	if (!left.bind_data.complex_filters.empty() || !right.bind_data.complex_filters.empty()) {
+		// The transpiled complex filters reference unqualified column names
+		return false;
+	}
+
+	string join_condition;
+	for (auto &cond : join.conditions) {
+		string condition;
+		if (!TransformJoinCondition(cond, left, right, condition)) {
+			return false;
+		}
+		AddCondition(join_condition, condition);
+	}
+
+	// Collect the columns the join produces
+	join.ResolveOperatorTypes();
+	const auto bindings = join.GetColumnBindings();
+	if (bindings.empty()) {
+		return false;
+	}
+
+	auto bind_data = make_uniq<TeradataBindData>();
+	vector<string> select_list;
+	case_insensitive_set_t used_names;
+	for (auto &binding : bindings) {
+		auto &relation = left.Contains(binding) ? left : right;
+		if (!relation.Contains(binding)) {
+			return false;
+		}
+		const auto col_idx = relation.GetColumnIndex(binding);
+
+		// Make sure the output column names are unique
+		auto name = relation.bind_data.names[col_idx];
+		for (idx_t suffix = 1; used_names.find(name) != used_names.end(); suffix++) {
+			name = relation.bind_data.names[col_idx] + "_" + to_string(suffix);
+		}
+		used_names.insert(name);
+
+		select_list.push_back(relation.GetColumnSQL(binding) + " AS " + KeywordHelper::WriteQuoted(name, '"'));
+		bind_data->names.push_back(name);
+		bind_data->types.push_back(relation.bind_data.types[col_idx]);
+		bind_data->td_types.push_back(relation.bind_data.td_types[col_idx]);
+	}
+
+	// Generate the remote SQL
+	const auto left_filter = left.GetFilterSQL();
+	const auto right_filter = right.GetFilterSQL();
+
+	string sql = "SELECT " + StringUtil::Join(select_list, ", ") + " FROM " + left.GetSourceSQL();
+	string where_clause;
+	switch (join.join_type) {
+	case JoinType::INNER:
+		sql += " INNER JOIN " + right.GetSourceSQL() + " ON " + join_condition;
+		AddCondition(where_clause, left_filter);
+		AddCondition(where_clause, right_filter);
+		break;
+	case JoinType::LEFT:
+		// Filters on the right side have to be applied before the join to preserve the unmatched left rows
+		AddCondition(join_condition, right_filter);
+		sql += " LEFT JOIN " + right.GetSourceSQL() + " ON " + join_condition;
+		AddCondition(where_clause, left_filter);
+		break;
+	case JoinType::SEMI:
+		AddCondition(join_condition, right_filter);
+		AddCondition(where_clause, "EXISTS (SELECT 1 FROM " + right.GetSourceSQL() + " WHERE " + join_condition + ")");
+		AddCondition(where_clause, left_filter);
+		break;
+	default:
+		throw InternalException("Unsupported join type for Teradata join pushdown");
+	}
+	if (!where_clause.empty()) {
+		sql += " WHERE " + where_clause;
+	}
+
+	bind_data->sql = std::move(sql);
+	bind_data->is_read_only = left.bind_data.is_read_only;
+	bind_data->access_lock = left.bind_data.access_lock || right.bind_data.access_lock;
+	bind_data->SetCatalog(catalog);
+
+	// Replace the join with a single remote query
+	const auto table_index = input.optimizer.binder.GenerateTableIndex();
+	auto types = bind_data->types;
+	auto names = bind_data->names;
+	auto get = make_uniq<LogicalGet>(table_index, TeradataQueryFunction::GetFunction(), std::move(bind_data),
+	                                 std::move(types), std::move(names));
+	for (idx_t col_idx = 0; col_idx < bindings.size(); col_idx++) {
+		get->AddColumnId(col_idx);
+	}
+	if (join.has_estimated_cardinality) {
+		get->SetEstimatedCardinality(join.estimated_cardinality);
+	}
+
+	RemoveJoinFilterPushdown(*root, left.get, right.get);
+
+	ColumnBindingReplacer replacer;
+	for (idx_t col_idx = 0; col_idx < bindings.size(); col_idx++) {
+		replacer.replacement_bindings.emplace_back(bindings[col_idx], ColumnBinding(table_index, col_idx));
+	}
+
+	op = std::move(get);
+	replacer.VisitOperator(*root);
+	return true;
+}
+
+static void PushdownJoins(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &root,
+                          unique_ptr<LogicalOperator> &op) {
+	// Bottom-up, so that chains of joins collapse into a single query
+	for (auto &child : op->children) {
+		PushdownJoins(input, root, child);
+	}
+	TryPushdownJoin(input, root, op);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Index Join
+//----------------------------------------------------------------------------------------------------------------------
+
+static bool TryIndexJoin(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &root,
+                         unique_ptr<LogicalOperator> &op, idx_t threshold) {
+	if (op->type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		return false;
+	}
+	auto &join = op->Cast<LogicalComparisonJoin>();
+	if (join.join_type != JoinType::INNER || join.predicate || join.conditions.empty()) {
+		return false;
+	}
+
+	// One side has to be a Teradata table, the other side a (small) local relation
+	optional_ptr<LogicalGet> get;
+	idx_t table_side = 0;
+	for (idx_t child_idx = 0; child_idx < 2; child_idx++) {
+		auto candidate = GetTeradataScan(*join.children[child_idx]);
+		if (candidate && !GetTeradataScan(*join.children[1 - child_idx])) {
+			get = candidate;
+			table_side = child_idx;
+			break;
+		}
+	}
+	if (!get) {
+		return false;
+	}
+	auto &bind_data = get->bind_data->Cast<TeradataBindData>();
+	auto table = bind_data.GetTable();
+	if (!table || !bind_data.sql.empty() || bind_data.shipped_keys) {
+		return false;
+	}
+
+	// The lookups are sent over the session of the transaction while the local side is being read, so it must not
+	// stream from a table of the same database
+	auto &local = *join.children[1 - table_side];
+	if (ScansCatalog(local, *bind_data.GetCatalog())) {
+		return false;
+	}
+	const auto local_cardinality = local.EstimateCardinality(input.context);
+	if (local_cardinality > threshold) {
+		return false;
+	}
+
+	// Only worth it if the table is known to be larger than the local relation, a scan is cheaper for small tables
+	const auto stats = table->GetTableStatistics(input.context);
+	if (!stats || stats->row_count <= local_cardinality) {
+		return false;
+	}
+
+	auto &schema = table->schema.Cast<TeradataSchemaEntry>();
+	const auto primary_index = schema.GetPrimaryIndex(input.context, table->name);
+	if (primary_index.empty()) {
+		return false;
+	}
+
+	// Every join condition becomes a predicate on a parameter in the lookup query
+	const auto local_bindings = local.GetColumnBindings();
+	vector<idx_t> key_columns;
+	vector<string> using_list;
+	vector<string> where_list;
+	case_insensitive_set_t equality_columns;
+
+	for (auto &cond : join.conditions) {
+		if (cond.left->type != ExpressionType::BOUND_COLUMN_REF ||
+		    cond.right->type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		auto &table_ref = (table_side == 0 ? cond.left : cond.right)->Cast<BoundColumnRefExpression>();
+		auto &local_ref = (table_side == 0 ? cond.right : cond.left)->Cast<BoundColumnRefExpression>();
+		if (table_ref.binding.table_index != get->table_index ||
+		    !TeradataParameters::IsSupported(local_ref.return_type)) {
+			return false;
+		}
+		// Teradata compares strings differently, which could return rows the join condition does not hold for
+		if (IsStringKey(table_ref) || IsStringKey(local_ref)) {
+			return false;
+		}
+
+		// Always put the table column on the left hand side of the comparison
+		const auto comparison = table_side == 0 ? cond.comparison : FlipComparisonExpression(cond.comparison);
+		string comparison_op;
+		if (!TransformJoinComparison(comparison, comparison_op)) {
+			return false;
+		}
+
+		idx_t key_column = DConstants::INVALID_INDEX;
+		for (idx_t binding_idx = 0; binding_idx < local_bindings.size(); binding_idx++) {
+			if (local_bindings[binding_idx] == local_ref.binding) {
+				key_column = binding_idx;
+				break;
+			}
+		}
+		if (key_column == DConstants::INVALID_INDEX) {
+			return false;
+		}
+
+		const auto param_name = "k" + to_string(key_columns.size());
+		const auto &col_name = bind_data.names[get->GetColumnIds()[table_ref.binding.column_index].GetPrimaryIndex()];
+
+		key_columns.push_back(key_column);
+		using_list.push_back(param_name + " " + TeradataType::FromDuckDB(local_ref.return_type).ToString());
+		where_list.push_back(KeywordHelper::WriteQuoted(col_name, '"') + " " + comparison_op + " :" + param_name);
+		if (comparison == ExpressionType::COMPARE_EQUAL) {
+			equality_columns.insert(col_name);
+		}
+	}
+
+	// Only worth it if we can access the rows through the primary index
+	for (auto &col_name : primary_index) {
+		if (equality_columns.find(col_name) == equality_columns.end()) {
+			return false;
+		}
+	}
+
+	// Construct the lookup query
+	vector<column_t> column_ids;
+	vector<string> select_list;
+	vector<LogicalType> fetch_types;
+	for (auto &col : get->GetColumnIds()) {
+		column_ids.push_back(col.GetPrimaryIndex());
+		select_list.push_back(KeywordHelper::WriteQuoted(bind_data.names[col.GetPrimaryIndex()], '"'));
+		fetch_types.push_back(bind_data.types[col.GetPrimaryIndex()]);
+	}
+	const auto filter = TeradataFilter::Transform(column_ids, get->table_filters, bind_data.names);
+	if (!filter.empty()) {
+		where_list.push_back(filter);
+	}
+	for (auto &complex_filter : bind_data.complex_filters) {
+		where_list.push_back(complex_filter);
+	}
+
+	auto sql = "USING (" + StringUtil::Join(using_list, ", ") + ") SELECT " + StringUtil::Join(select_list, ", ") +
+	           " FROM " + KeywordHelper::WriteQuoted(bind_data.schema_name, '"') + "." +
+	           KeywordHelper::WriteQuoted(bind_data.table_name, '"') + " WHERE " +
+	           StringUtil::Join(where_list, " AND ") + ";";
+
+	// Replace the join with the index join
+	const auto table_index = input.optimizer.binder.GenerateTableIndex();
+	auto index_join = make_uniq<LogicalTeradataIndexJoin>(table_index, *bind_data.GetCatalog(), table->name,
+	                                                      std::move(sql), std::move(key_columns), fetch_types);
+	index_join->children.push_back(std::move(join.children[1 - table_side]));
+	index_join->ResolveOperatorTypes();
+	if (join.has_estimated_cardinality) {
+		index_join->SetEstimatedCardinality(join.estimated_cardinality);
+	}
+
+	RemoveJoinFilterPushdown(*root, *get, *get);
+
+	ColumnBindingReplacer replacer;
+	for (idx_t col_idx = 0; col_idx < fetch_types.size(); col_idx++) {
+		replacer.replacement_bindings.emplace_back(ColumnBinding(get->table_index, col_idx),
+		                                           ColumnBinding(table_index, col_idx));
+	}
+
+	op = std::move(index_join);
+	replacer.VisitOperator(*root);
+	return true;
+}
+
+static void IndexJoins(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &root,
+                       unique_ptr<LogicalOperator> &op, idx_t threshold) {
+	for (auto &child : op->children) {
+		IndexJoins(input, root, child, threshold);
+	}
+	TryIndexJoin(input, root, op, threshold);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Key Shipping
+//----------------------------------------------------------------------------------------------------------------------
+
+static void TryShipJoinKeys(OptimizerExtensionInput &input, LogicalOperator &op, idx_t threshold) {
+	if (op.type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		return;
+	}
+	auto &join = op.Cast<LogicalComparisonJoin>();
+
+	// The Teradata scan is on the probe side, so only rows of it that match a key of the build side are needed
+	if (join.join_type != JoinType::INNER && join.join_type != JoinType::SEMI && join.join_type != JoinType::RIGHT) {
+		return;
+	}
+	auto probe_get = GetTeradataScan(*join.children[0]);
+	if (!probe_get || GetTeradataScan(*join.children[1])) {
+		return;
+	}
+	auto &bind_data = probe_get->bind_data->Cast<TeradataBindData>();
+	if (bind_data.shipped_keys) {
+		return;
+	}
+	// A query could reference objects of the session, keep shipping keys to scans of tables
+	if (!bind_data.sql.empty()) {
+		return;
+	}
+
+	// Only worth it if the build side is too large for the dynamic min/max filters to be selective
+	if (join.children[1]->EstimateCardinality(input.context) < threshold) {
+		return;
+	}
+
+	// Find an equality condition between a column of the scan and a column of the build side
+	const auto build_bindings = join.children[1]->GetColumnBindings();
+	for (auto &cond : join.conditions) {
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL) {
+			continue;
+		}
+		if (cond.left->type != ExpressionType::BOUND_COLUMN_REF || cond.right->type != ExpressionType::BOUND_COLUMN_REF) {
+			continue;
+		}
+		auto &probe_ref = cond.left->Cast<BoundColumnRefExpression>();
+		auto &build_ref = cond.right->Cast<BoundColumnRefExpression>();
+		if (probe_ref.binding.table_index != probe_get->table_index ||
+		    !TeradataParameters::IsSupported(build_ref.return_type)) {
+			continue;
+		}
+
+		idx_t key_index = DConstants::INVALID_INDEX;
+		for (idx_t binding_idx = 0; binding_idx < build_bindings.size(); binding_idx++) {
+			if (build_bindings[binding_idx] == build_ref.binding) {
+				key_index = binding_idx;
+				break;
+			}
+		}
+		if (key_index == DConstants::INVALID_INDEX) {
+			continue;
+		}
+
+		const auto col_idx = probe_get->GetColumnIds()[probe_ref.binding.column_index].GetPrimaryIndex();
+		auto keys = make_shared_ptr<TeradataShippedKeys>(*bind_data.GetCatalog(), bind_data.names[col_idx],
+		                                                 build_ref.return_type, bind_data.td_types[col_idx]);
+		bind_data.shipped_keys = keys;
+
+		// Ship the keys while collecting the build side
+		auto shipping = make_uniq<LogicalTeradataKeyShipping>(key_index, std::move(keys));
+		shipping->children.push_back(std::move(join.children[1]));
+		shipping->ResolveOperatorTypes();
+		shipping->SetEstimatedCardinality(shipping->children[0]->estimated_cardinality);
+		join.children[1] = std::move(shipping);
+		return;
+	}
+}
+
+static void ShipJoinKeys(OptimizerExtensionInput &input, LogicalOperator &op, idx_t threshold) {
+	for (auto &child : op.children) {
+		ShipJoinKeys(input, *child, threshold);
+	}
+	TryShipJoinKeys(input, op, threshold);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Optimize
+//----------------------------------------------------------------------------------------------------------------------
+
+void TeradataOptimizer::Optimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan) {
+	Value join_pushdown_value;
+	bool join_pushdown = true;
+	if (input.context.TryGetCurrentSetting("teradata_join_pushdown", join_pushdown_value)) {
+		join_pushdown = join_pushdown_value.GetValue<bool>();
+	}
+
+	if (join_pushdown) {
+		PushdownJoins(input, plan, plan);
+	}
+
+	Value index_join_threshold_value;
+	idx_t index_join_threshold = 100000;
+	if (input.context.TryGetCurrentSetting("teradata_index_join_threshold", index_join_threshold_value)) {
+		index_join_threshold = index_join_threshold_value.GetValue<idx_t>();
+	}
+
+	if (index_join_threshold > 0) {
+		IndexJoins(input, plan, plan, index_join_threshold);
+	}
+
+	Value key_shipping_threshold_value;
+	idx_t key_shipping_threshold = 10000;
+	if (input.context.TryGetCurrentSetting("teradata_key_shipping_threshold", key_shipping_threshold_value)) {
+		key_shipping_threshold = key_shipping_threshold_value.GetValue<idx_t>();
+	}
+
+	if (key_shipping_threshold > 0) {
+		ShipJoinKeys(input, *plan, key_shipping_threshold);
+	}
+}
+
+void TeradataOptimizer::Register(DBConfig &config) {
+	OptimizerExtension extension;
+	extension.optimize_function = TeradataOptimizer::Optimize;
+	config.optimizer_extensions.push_back(std::move(extension));
+}
+
+} // namespace duckdb
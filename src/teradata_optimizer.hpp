@@ -0,0 +1,14 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/optimizer/optimizer_extension.hpp"
+
+namespace duckdb {
+
+class TeradataOptimizer {
+public:
+	static void Optimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan);
+	static void Register(DBConfig &config);
+};
+
+} // namespace duckdb
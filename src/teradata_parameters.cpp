@@ -0,0 +1,60 @@
+#include "teradata_parameters.hpp"
+#include "teradata_type.hpp"
+#include "teradata_column_writer.hpp"
+
+namespace duckdb {
+
+// Teradata limits the number of fields in a USING clause, stay well below that
+static constexpr idx_t MAX_PARAMETERS = 1024;
+
+bool TeradataParameters::IsSupported(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::VARCHAR:
+		return !type.IsJSONType();
+	default:
+		return false;
+	}
+}
+
+string TeradataParameters::Add(const Value &value) {
+	D_ASSERT(IsSupported(value.type()));
+	if (values.size() >= MAX_PARAMETERS) {
+		return string();
+	}
+	values.push_back(value);
+	return ":p" + to_string(values.size() - 1);
+}
+
+string TeradataParameters::GetUsingClause() const {
+	string result = "USING (";
+	for (idx_t param_idx = 0; param_idx < values.size(); param_idx++) {
+		if (param_idx > 0) {
+			result += ", ";
+		}
+		result += "p" + to_string(param_idx) + " " + TeradataType::FromDuckDB(values[param_idx].type()).ToString();
+	}
+	result += ") ";
+	return result;
+}
+
+void TeradataParameters::GetData(DataChunk &chunk, vector<unique_ptr<TeradataColumnWriter>> &writers) const {
+	vector<LogicalType> types;
+	for (auto &value : values) {
+		types.push_back(value.type());
+		writers.push_back(TeradataColumnWriter::Make(value.type()));
+	}
+	chunk.Initialize(Allocator::DefaultAllocator(), types);
+	for (idx_t param_idx = 0; param_idx < values.size(); param_idx++) {
+		chunk.SetValue(param_idx, 0, values[param_idx]);
+	}
+	chunk.SetCardinality(1);
+}
+
+} // namespace duckdb
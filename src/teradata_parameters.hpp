@@ -0,0 +1,36 @@
+#pragma once
+
+#include "teradata_common.hpp"
+
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+
+namespace duckdb {
+
+class TeradataColumnWriter;
+
+// Values passed to a request in its USING data parcel instead of being inlined into the SQL text. Teradata caches the
+// plans of requests by their text, so a request only differing in its parameter values can reuse the cached plan.
+class TeradataParameters {
+public:
+	//! Whether values of this type can be passed as a parameter
+	static bool IsSupported(const LogicalType &type);
+
+	//! Add a parameter, returning the placeholder to reference it with in the SQL.
+	//! Returns an empty string if no more parameters can be added, in which case the value has to be inlined.
+	string Add(const Value &value);
+
+	bool Empty() const {
+		return values.empty();
+	}
+
+	//! The USING request modifier declaring the parameters, to prefix the request with
+	string GetUsingClause() const;
+	//! Initialize a single row chunk holding the parameter values, and the writers to encode it with
+	void GetData(DataChunk &chunk, vector<unique_ptr<TeradataColumnWriter>> &writers) const;
+
+private:
+	vector<Value> values;
+};
+
+} // namespace duckdb
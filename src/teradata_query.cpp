@@ -6,8 +6,18 @@
 #include "teradata_catalog.hpp"
 #include "teradata_transaction.hpp"
 #include "teradata_table_entry.hpp"
+#include "teradata_key_shipping.hpp"
+#include "teradata_parameters.hpp"
+#include "teradata_column_writer.hpp"
+#include "teradata_expression.hpp"
 
 #include "duckdb/main/extension/extension_loader.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/table_filter.hpp"
 
 #include <teradata_filter.hpp>
 
@@ -16,6 +26,243 @@ namespace duckdb {
 //----------------------------------------------------------------------------------------------------------------------
 // Bind
 //----------------------------------------------------------------------------------------------------------------------
+// Find the position of the top-level ORDER BY of the query, if it has one and does not limit the rows with TOP.
+// Teradata does not allow such an ORDER BY in a derived table.
+static idx_t FindOrderBy(const string &sql) {
+	idx_t depth = 0;
+	idx_t order_by_pos = DConstants::INVALID_INDEX;
+	bool has_top = false;
+	string prev_word;
+	idx_t prev_word_pos = 0;
+
+	idx_t pos = 0;
+	while (pos < sql.size()) {
+		const auto c = sql[pos];
+		if (c == '\'' || c == '"') {
+			const auto end = sql.find(c, pos + 1);
+			pos = end == string::npos ? sql.size() : end + 1;
+		} else if (c == '-' && pos + 1 < sql.size() && sql[pos + 1] == '-') {
+			const auto end = sql.find('\n', pos);
+			pos = end == string::npos ? sql.size() : end;
+		} else if (c == '/' && pos + 1 < sql.size() && sql[pos + 1] == '*') {
+			const auto end = sql.find("*/", pos + 2);
+			pos = end == string::npos ? sql.size() : end + 2;
+		} else if (c == '(') {
+			depth++;
+			pos++;
+		} else if (c == ')') {
+			depth = depth > 0 ? depth - 1 : 0;
+			pos++;
+		} else if (StringUtil::CharacterIsAlpha(c) || c == '_') {
+			const auto start = pos;
+			while (pos < sql.size() && (StringUtil::CharacterIsAlphaNumeric(sql[pos]) || sql[pos] == '_')) {
+				pos++;
+			}
+			auto word = StringUtil::Upper(sql.substr(start, pos - start));
+			if (depth == 0) {
+				if (word == "TOP") {
+					has_top = true;
+				} else if (word == "BY" && prev_word == "ORDER") {
+					order_by_pos = prev_word_pos;
+				}
+			}
+			prev_word = std::move(word);
+			prev_word_pos = start;
+		} else {
+			pos++;
+		}
+	}
+
+	return has_top ? DConstants::INVALID_INDEX : order_by_pos;
+}
+
+// Remove a trailing ORDER BY from the query, which does not affect the rows it produces (e.g. to join it)
+static string StripOrderBy(const string &sql) {
+	const auto order_by_pos = FindOrderBy(sql);
+	if (order_by_pos == DConstants::INVALID_INDEX) {
+		return sql;
+	}
+	auto result = sql.substr(0, order_by_pos);
+	StringUtil::RTrim(result);
+	return result;
+}
+
+string TeradataBindData::GetSourceSQL(const string &alias) const {
+	if (sql.empty()) {
+		return KeywordHelper::WriteQuoted(schema_name, '"') + "." + KeywordHelper::WriteQuoted(table_name, '"') +
+		       " AS " + alias;
+	}
+	// Name the columns of the derived table explicitly, as the query might contain unnamed expressions
+	vector<string> column_list;
+	for (auto &name : names) {
+		column_list.push_back(KeywordHelper::WriteQuoted(name, '"'));
+	}
+	return "(" + StripOrderBy(sql) + ") AS " + alias + " (" + StringUtil::Join(column_list, ", ") + ")";
+}
+
+// Convert an argument into a value we can pass to Teradata as a parameter
+static Value GetParameterValue(const Value &val) {
+	if (TeradataParameters::IsSupported(val.type())) {
+		return val;
+	}
+	if (val.type().id() == LogicalTypeId::BOOLEAN) {
+		// Booleans are stored as BYTEINT
+		return val.DefaultCastAs(LogicalType::TINYINT);
+	}
+	// Pass anything else as a string, Teradata implicitly converts it to the type it is compared with
+	return val.DefaultCastAs(LogicalType::VARCHAR);
+}
+
+// Collect the parameters passed after the SQL string. A single LIST or STRUCT argument holds all parameters.
+static void GetParameterValues(const vector<Value> &inputs, vector<Value> &result) {
+	if (inputs.size() == 3 && !inputs[2].IsNull()) {
+		auto &arg = inputs[2];
+		if (arg.type().id() == LogicalTypeId::LIST) {
+			for (auto &child : ListValue::GetChildren(arg)) {
+				result.push_back(GetParameterValue(child));
+			}
+			return;
+		}
+		if (arg.type().id() == LogicalTypeId::STRUCT) {
+			for (auto &child : StructValue::GetChildren(arg)) {
+				result.push_back(GetParameterValue(child));
+			}
+			return;
+		}
+	}
+	for (idx_t arg_idx = 2; arg_idx < inputs.size(); arg_idx++) {
+		result.push_back(GetParameterValue(inputs[arg_idx]));
+	}
+}
+
+// Replace the "?" placeholders in the SQL with references to the USING parameters
+static string BindParameters(const string &sql, const vector<Value> &values, TeradataParameters &parameters) {
+	string result;
+	idx_t param_idx = 0;
+	idx_t pos = 0;
+	while (pos < sql.size()) {
+		const auto c = sql[pos];
+		if (c == '\'' || c == '"') {
+			// Skip over string literals and quoted identifiers
+			auto end = sql.find(c, pos + 1);
+			end = end == string::npos ? sql.size() : end + 1;
+			result += sql.substr(pos, end - pos);
+			pos = end;
+		} else if (c == '-' && pos + 1 < sql.size() && sql[pos + 1] == '-') {
+			// Skip over single line comments
+			auto end = sql.find('\n', pos);
+			end = end == string::npos ? sql.size() : end;
+			result += sql.substr(pos, end - pos);
+			pos = end;
+		} else if (c == '/' && pos + 1 < sql.size() && sql[pos + 1] == '*') {
+			// Skip over block comments
+			auto end = sql.find("*/", pos + 2);
+			end = end == string::npos ? sql.size() : end + 2;
+			result += sql.substr(pos, end - pos);
+			pos = end;
+		} else if (c == '?') {
+			if (param_idx >= values.size()) {
+				throw BinderException("teradata_query: the query has more parameter placeholders than the %d "
+				                      "parameters passed",
+				                      values.size());
+			}
+			auto placeholder = parameters.Add(values[param_idx++]);
+			if (placeholder.empty()) {
+				throw BinderException("teradata_query: too many parameters");
+			}
+			result += placeholder;
+			pos++;
+		} else {
+			result += c;
+			pos++;
+		}
+	}
+	if (param_idx != values.size()) {
+		throw BinderException("teradata_query: %d parameters passed, but the query has %d parameter placeholders",
+		                      values.size(), param_idx);
+	}
+	return result;
+}
+
+// The request that is prepared to get the result types of the query
+static string GetPrepareSQL(const string &sql, const TeradataParameters &parameters) {
+	return parameters.Empty() ? sql : parameters.GetUsingClause() + sql;
+}
+
+// Teradata reports the estimated size of every spool built by the plan as
+// "... is estimated with <level> confidence to be 1,234 rows (56,789 bytes)".
+// The result of the query is the last spool that is built, so use the last estimate in the plan.
+static bool TryParseExplainEstimate(const string &plan, idx_t &result) {
+	static constexpr const char *ESTIMATE_MARKER = "estimated with";
+	static constexpr const char *ROWS_MARKER = "to be ";
+
+	bool found = false;
+	for (auto pos = plan.find(ESTIMATE_MARKER); pos != string::npos; pos = plan.find(ESTIMATE_MARKER, pos + 1)) {
+		auto start = plan.find(ROWS_MARKER, pos);
+		if (start == string::npos) {
+			break;
+		}
+		start += strlen(ROWS_MARKER);
+
+		idx_t rows = 0;
+		auto end = start;
+		for (; end < plan.size(); end++) {
+			const auto c = plan[end];
+			if (StringUtil::CharacterIsDigit(c)) {
+				rows = MinValue<idx_t>(rows, NumericLimits<idx_t>::Maximum() / 10) * 10 + (c - '0');
+			} else if (c != ',') {
+				break;
+			}
+		}
+		if (end > start && plan.compare(end, 4, " row") == 0) {
+			result = rows;
+			found = true;
+		}
+	}
+	return found;
+}
+
+// Ask the Teradata optimizer for the estimated number of rows returned by the query
+static optional_idx GetExplainEstimate(TeradataConnection &con, const string &sql,
+                                       const TeradataParameters &parameters) {
+	const auto explain_sql = "EXPLAIN " + GetPrepareSQL(sql, parameters);
+
+	unique_ptr<TeradataQueryResult> result;
+	if (parameters.Empty()) {
+		result = con.Query(explain_sql, false);
+	} else {
+		DataChunk param_chunk;
+		vector<unique_ptr<TeradataColumnWriter>> writers;
+		parameters.GetData(param_chunk, writers);
+
+		ArenaAllocator arena(Allocator::DefaultAllocator());
+		result = con.Query(explain_sql, param_chunk, arena, writers, false);
+	}
+
+	// The plan is returned as one row per line, sentences may be wrapped across lines
+	string plan;
+	for (auto &chunk : result->Chunks()) {
+		chunk.Flatten();
+		const auto &line_vec = chunk.data[0];
+		const auto lines = FlatVector::GetData<string_t>(line_vec);
+		for (idx_t row_idx = 0; row_idx < chunk.size(); row_idx++) {
+			if (FlatVector::IsNull(line_vec, row_idx)) {
+				continue;
+			}
+			auto line = lines[row_idx].GetString();
+			StringUtil::Trim(line);
+			plan += line;
+			plan += " ";
+		}
+	}
+
+	idx_t rows;
+	if (!TryParseExplainEstimate(plan, rows)) {
+		return optional_idx();
+	}
+	return rows;
+}
+
 static unique_ptr<FunctionData> TeradataQueryBind(ClientContext &context, TableFunctionBindInput &input,
                                                   vector<LogicalType> &return_types, vector<string> &names) {
 
@@ -48,27 +295,73 @@ static unique_ptr<FunctionData> TeradataQueryBind(ClientContext &context, TableF
 		StringUtil::RTrim(sql);
 	}
 
-	auto &con = transaction.GetConnection();
+	// Bind any parameters passed after the SQL string to its placeholders
+	vector<Value> values;
+	GetParameterValues(input.inputs, values);
 
+	TeradataParameters parameters;
+	if (!values.empty()) {
+		sql = BindParameters(sql, values, parameters);
+	}
+
+	// Only prepare the query if we have not done so before, to save a round trip
 	vector<TeradataType> td_types;
-	con.Prepare(sql, td_types, names);
+	td_catalog.Prepare(transaction.GetConnectionWithoutTransaction(), GetPrepareSQL(sql, parameters), td_types, names);
 
 	// Convert to DuckDB types
 	for (auto &td_type : td_types) {
 		return_types.push_back(td_type.ToDuckDB());
 	}
 
+	// The names are also used to reference the columns when we push down into the query as a derived table,
+	// so they have to be unique (Teradata names are case insensitive)
+	case_insensitive_set_t unique_names;
+	for (idx_t col_idx = 0; col_idx < names.size(); col_idx++) {
+		auto &name = names[col_idx];
+		if (name.empty()) {
+			name = "col" + to_string(col_idx);
+		}
+		auto unique_name = name;
+		for (idx_t suffix = 1; unique_names.find(unique_name) != unique_names.end(); suffix++) {
+			unique_name = name + "_" + to_string(suffix);
+		}
+		unique_names.insert(unique_name);
+		name = std::move(unique_name);
+	}
+
 	if (td_types.empty()) {
 		throw BinderException("No fields returned by query \"%s\" - the query must be a SELECT statement that returns "
 		                      "at least one column",
 		                      sql);
 	}
 
+	// Optionally ask Teradata how many rows the query is estimated to return, so that DuckDB can plan around it
+	bool estimate = false;
+	Value estimate_value;
+	if (context.TryGetCurrentSetting("teradata_query_estimate", estimate_value)) {
+		estimate = estimate_value.GetValue<bool>();
+	}
+	auto access_lock = td_catalog.UseAccessLock(context);
+	for (auto &kv : input.named_parameters) {
+		if (kv.first == "estimate") {
+			estimate = BooleanValue::Get(kv.second);
+		} else if (kv.first == "access_lock") {
+			access_lock = BooleanValue::Get(kv.second);
+		}
+	}
+
 	auto result = make_uniq<TeradataBindData>();
 	result->types = return_types;
 	result->td_types = std::move(td_types);
 	result->names = names;
 	result->sql = sql;
+	result->is_ordered = FindOrderBy(sql) != DConstants::INVALID_INDEX;
+	result->access_lock = access_lock;
+	if (estimate) {
+		auto &con = transaction.GetConnectionWithoutTransaction();
+		result->estimated_cardinality = GetExplainEstimate(con, sql, parameters);
+	}
+	result->parameters = std::move(parameters);
 	result->SetCatalog(td_catalog);
 
 	return std::move(result);
@@ -84,6 +377,82 @@ static BindInfo TeradataQueryBindInfo(const optional_ptr<FunctionData> bind_data
 	return info;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// Statistics
+//----------------------------------------------------------------------------------------------------------------------
+static unique_ptr<NodeStatistics> TeradataQueryCardinality(ClientContext &context, const FunctionData *bind_data_p) {
+	auto &bind_data = bind_data_p->Cast<TeradataBindData>();
+	if (bind_data.estimated_cardinality.IsValid()) {
+		return make_uniq<NodeStatistics>(bind_data.estimated_cardinality.GetIndex());
+	}
+	const auto table = bind_data.GetTable();
+	if (!table) {
+		return nullptr;
+	}
+	const auto stats = table->GetTableStatistics(context);
+	if (!stats) {
+		return nullptr;
+	}
+	// The statistics may be stale, so this is only an estimate and not an upper bound
+	return make_uniq<NodeStatistics>(stats->row_count);
+}
+
+static unique_ptr<BaseStatistics> TeradataQueryStatistics(ClientContext &context, const FunctionData *bind_data_p,
+                                                          column_t column_index) {
+	auto &bind_data = bind_data_p->Cast<TeradataBindData>();
+	const auto table = bind_data.GetTable();
+	if (!table || IsVirtualColumn(column_index)) {
+		return nullptr;
+	}
+	return table->GetStatistics(context, column_index);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Complex Filter Pushdown
+//----------------------------------------------------------------------------------------------------------------------
+static void TeradataQueryPushdownComplexFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p,
+                                               vector<unique_ptr<Expression>> &filters) {
+	Value complex_filter_pushdown_value;
+	if (context.TryGetCurrentSetting("teradata_complex_filter_pushdown", complex_filter_pushdown_value) &&
+	    !complex_filter_pushdown_value.GetValue<bool>()) {
+		return;
+	}
+
+	auto &bind_data = bind_data_p->Cast<TeradataBindData>();
+	if (bind_data.is_ordered) {
+		// The query is sent as-is to keep its order, the filters are evaluated locally
+		return;
+	}
+	const auto &column_ids = get.GetColumnIds();
+
+	const auto resolver = [&](const Expression &expr, string &result) {
+		if (expr.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+			return false;
+		}
+		auto &ref = expr.Cast<BoundColumnRefExpression>();
+		if (ref.binding.table_index != get.table_index || ref.binding.column_index >= column_ids.size()) {
+			return false;
+		}
+		const auto col_idx = column_ids[ref.binding.column_index].GetPrimaryIndex();
+		if (col_idx >= bind_data.names.size()) {
+			// E.g. the row id
+			return false;
+		}
+		result = KeywordHelper::WriteQuoted(bind_data.names[col_idx], '"');
+		return true;
+	};
+
+	// The filters we can transpile are also evaluated by Teradata, to reduce the rows we have to transfer.
+	// We still evaluate them locally as well, as the result of some functions and comparisons in Teradata depend on
+	// the collation of the columns (e.g. NOT CASESPECIFIC), which could let through more rows than expected.
+	for (auto &filter : filters) {
+		string filter_sql;
+		if (TeradataExpression::TryTransform(*filter, resolver, filter_sql)) {
+			bind_data.complex_filters.push_back(std::move(filter_sql));
+		}
+	}
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // Init
 //----------------------------------------------------------------------------------------------------------------------
@@ -91,42 +460,140 @@ struct TeradataQueryState final : GlobalTableFunctionState {
 	unique_ptr<TeradataQueryResult> td_query;
 	DataChunk scan_chunk;
 	vector<column_t> column_ids;
+	optional_ptr<TableFilterSet> filters;
+	// The pushed down filters, evaluated locally for queries that are sent as-is
+	unique_ptr<Expression> local_filter;
+	unique_ptr<ExpressionExecutor> local_filter_executor;
+	bool parameterize_filters = true;
+	// The request sent to Teradata, reported in the profiler output
+	string request_sql;
 };
 
-static unique_ptr<GlobalTableFunctionState> TeradataQueryInit(ClientContext &context, TableFunctionInitInput &input) {
-	auto &data = input.bind_data->Cast<TeradataBindData>();
-	string sql = data.sql;
+static bool IsSelectQuery(const string &sql) {
+	idx_t pos = 0;
+	while (pos < sql.size() && StringUtil::CharacterIsSpace(sql[pos])) {
+		pos++;
+	}
+	const auto start = pos;
+	while (pos < sql.size() && StringUtil::CharacterIsAlpha(sql[pos])) {
+		pos++;
+	}
+	const auto keyword = StringUtil::Upper(sql.substr(start, pos - start));
+	return keyword == "SELECT" || keyword == "SEL";
+}
 
-	// If we dont have a SQL string, just copy from the table
-	if (sql.empty()) {
-		if (data.table_name.empty()) {
-			throw InvalidInputException("Teradata query requires a valid SQL string");
-		}
+static unique_ptr<TeradataQueryResult> TeradataQueryStart(const TeradataBindData &data,
+                                                          const TeradataQueryState &state, string &request_sql) {
+	if (data.sql.empty() && data.table_name.empty()) {
+		throw InvalidInputException("Teradata query requires a valid SQL string");
+	}
 
-		// If we get here, we have a table name, so we need to construct a SQL string
-		sql = StringUtil::Format("SELECT * FROM %s.%s", data.schema_name, data.table_name);
+	// The columns to fetch from Teradata, in the order they are scanned
+	vector<column_t> remote_columns;
+	for (auto &col_idx : state.column_ids) {
+		if (col_idx == COLUMN_IDENTIFIER_ROW_ID) {
+			throw InvalidInputException("Teradata query does not support the row id column (rowid)");
+		}
+		if (!data.is_ordered) {
+			remote_columns.push_back(col_idx);
+		}
+	}
+	if (data.is_ordered) {
+		// Wrapping the query would lose its order, so fetch all of its columns and project them locally
+		for (idx_t col_idx = 0; col_idx < data.names.size(); col_idx++) {
+			remote_columns.push_back(col_idx);
+		}
+	} else if (remote_columns.empty()) {
+		// We still need to fetch a column to know how many rows there are, e.g. for COUNT(*)
+		remote_columns.push_back(0);
 	}
 
 	// Also add simple filters if we got them
-	if (input.filters) {
-		const auto where_clause = TeradataFilter::Transform(input.column_ids, *input.filters, data.names);
+	string where_clause;
+	// The filter constants are added after the parameters of the query itself
+	auto params = data.parameters;
+	if (state.filters && !data.is_ordered) {
+		where_clause = TeradataFilter::Transform(state.column_ids, state.filters, data.names, string(),
+		                                         state.parameterize_filters ? &params : nullptr);
+	}
+	for (auto &filter : data.complex_filters) {
+		if (!where_clause.empty()) {
+			where_clause += " AND ";
+		}
+		where_clause += filter;
+	}
+
+	// If the join keys of the other side were shipped to Teradata, filter on them
+	const auto use_shipped_keys = data.shipped_keys && data.shipped_keys->IsShipped();
+	if (use_shipped_keys) {
+		if (!where_clause.empty()) {
+			where_clause += " AND ";
+		}
+		where_clause += data.shipped_keys->GetFilter();
+	}
+
+	bool is_full_projection = remote_columns.size() == data.names.size();
+	for (idx_t col_idx = 0; col_idx < remote_columns.size() && is_full_projection; col_idx++) {
+		is_full_projection = remote_columns[col_idx] == col_idx;
+	}
+
+	string sql;
+	if (!data.sql.empty() && is_full_projection && where_clause.empty()) {
+		// Nothing to push down, send the query as-is
+		sql = data.sql;
+	} else {
+		// Only select the columns we need, and filter the query (or table) as a derived table, so that the filters
+		// can not interfere with the clauses of the query itself
+		vector<string> select_list;
+		for (auto &col_idx : remote_columns) {
+			select_list.push_back(KeywordHelper::WriteQuoted(data.names[col_idx], '"'));
+		}
+		sql = "SELECT " + StringUtil::Join(select_list, ", ") + " FROM " + data.GetSourceSQL("t");
 		if (!where_clause.empty()) {
 			sql += " WHERE " + where_clause;
 		}
 	}
 
-	auto result = make_uniq<TeradataQueryState>();
-	result->column_ids = input.column_ids;
+	// Shipped keys are only visible in the session of the transaction, which they were shipped over
+	optional_ptr<TeradataConnection> con = &data.GetCatalog()->GetConnection();
+	// The LOCKING modifier only applies to SELECT requests, a raw query could also be e.g. a HELP or SHOW statement
+	if (data.access_lock && IsSelectQuery(sql)) {
+		sql = "LOCKING ROW FOR ACCESS " + sql;
+	}
 
-	auto &con = data.GetCatalog()->GetConnection();
-	result->td_query = con.Query(sql, data.is_materialized);
+	unique_ptr<TeradataQueryResult> result;
+	if (params.Empty()) {
+		request_sql = sql;
+		result = con->Query(sql, data.is_materialized);
+	} else {
+		// The USING modifier has to come first in the request
+		sql = params.GetUsingClause() + sql;
+		request_sql = sql;
+
+		DataChunk param_chunk;
+		vector<unique_ptr<TeradataColumnWriter>> writers;
+		params.GetData(param_chunk, writers);
+
+		ArenaAllocator arena(Allocator::DefaultAllocator());
+		result = con->Query(sql, param_chunk, arena, writers, data.is_materialized);
+	}
 
 	// Check that the types are still the same, in case we need to rebind
-	auto &td_types = result->td_query->GetTypes();
+	auto &td_types = result->GetTypes();
+
+	if (td_types.size() != remote_columns.size()) {
+		if (!data.sql.empty()) {
+			data.GetCatalog()->EvictPrepared(GetPrepareSQL(data.sql, data.parameters));
+		}
+		throw InvalidInputException("Teradata query schema has changed since it was last bound!\n"
+		                            "Expected %d columns but received %d\n"
+		                            "Please re-execute or re-prepare the query",
+		                            remote_columns.size(), td_types.size());
+	}
 
 	for (idx_t i = 0; i < td_types.size(); i++) {
 		// Compare the types of the query with the types we got during binding
-		auto &expected = data.td_types[i];
+		auto &expected = data.td_types[remote_columns[i]];
 		auto &actual = td_types[i];
 
 		if (actual != expected) {
@@ -160,15 +627,69 @@ static unique_ptr<GlobalTableFunctionState> TeradataQueryInit(ClientContext &con
 				continue;
 			}
 
+			// Make sure the query is prepared again when it is re-executed
+			if (!data.sql.empty()) {
+				data.GetCatalog()->EvictPrepared(GetPrepareSQL(data.sql, data.parameters));
+			}
 			throw InvalidInputException("Teradata query schema has changed since it was last bound!\n"
 			                            "Column: '%s' expected to be of type '%s' but received '%s'\n"
 			                            "Please re-execute or re-prepare the query",
-			                            data.names[i], expected.ToString(), actual.ToString());
+			                            data.names[remote_columns[i]], expected.ToString(), actual.ToString());
 		}
 	}
 
-	// Initialize the scan chunk
-	result->td_query->InitScanChunk(result->scan_chunk);
+	return result;
+}
+
+// Combine the filters into a single expression over the scanned columns
+static unique_ptr<Expression> GetLocalFilter(const TableFilterSet &filters, const vector<LogicalType> &types,
+                                             const vector<column_t> &column_ids) {
+	unique_ptr<Expression> result;
+	for (auto &entry : filters.filters) {
+		const auto col_idx = column_ids[entry.first];
+		BoundReferenceExpression column(types[col_idx], entry.first);
+		auto expr = entry.second->ToExpression(column);
+		if (!result) {
+			result = std::move(expr);
+		} else {
+			result = make_uniq<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_AND, std::move(result),
+			                                               std::move(expr));
+		}
+	}
+	return result;
+}
+
+static unique_ptr<GlobalTableFunctionState> TeradataQueryInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto &data = input.bind_data->Cast<TeradataBindData>();
+
+	auto result = make_uniq<TeradataQueryState>();
+	result->column_ids = input.column_ids;
+	result->filters = input.filters;
+
+	if (data.is_ordered && input.filters) {
+		result->local_filter = GetLocalFilter(*input.filters, data.types, input.column_ids);
+		if (result->local_filter) {
+			result->local_filter_executor = make_uniq<ExpressionExecutor>(context, *result->local_filter);
+		}
+	}
+
+	Value parameterize_filters_value;
+	if (context.TryGetCurrentSetting("teradata_parameterize_filters", parameterize_filters_value)) {
+		result->parameterize_filters = parameterize_filters_value.GetValue<bool>();
+	}
+
+	if (data.read_in_transaction) {
+		// Begin the transaction before reading, so that the rows do not change before they are written back
+		TeradataTransaction::Get(context, *data.GetCatalog()).GetConnection();
+	}
+
+	// The filters of a join (e.g. the min/max of its build side) are already part of the filters once the scan is
+	// initialized. Join keys shipped to Teradata by the other side of the join are only shipped while it is built,
+	// in that case defer sending the query to Teradata until the first call to execute.
+	if (!data.shipped_keys) {
+		result->td_query = TeradataQueryStart(data, *result, result->request_sql);
+		result->td_query->InitScanChunk(result->scan_chunk);
+	}
 
 	return std::move(result);
 }
@@ -176,32 +697,68 @@ static unique_ptr<GlobalTableFunctionState> TeradataQueryInit(ClientContext &con
 //----------------------------------------------------------------------------------------------------------------------
 // Execute
 //----------------------------------------------------------------------------------------------------------------------
+// Cast all vectors
+// For most types, this is a no-op, the target just references the source.
+// But there are some special cases, like TIMESTAMP that always gets transmitted as VARCHAR.
+// The columns are fetched from Teradata in the order they are scanned, or all of them if the query is sent as-is
+static void CastScanChunk(const TeradataBindData &bind_data, const TeradataQueryState &state, DataChunk &scan_chunk,
+                          DataChunk &output) {
+	const auto count = scan_chunk.size();
+	for (idx_t output_idx = 0; output_idx < state.column_ids.size(); output_idx++) {
+		const auto scan_idx = bind_data.is_ordered ? state.column_ids[output_idx] : output_idx;
+		auto &source = scan_chunk.data[scan_idx];
+		auto &target = output.data[output_idx];
+
+		VectorOperations::DefaultCast(source, target, count);
+	}
+
+	output.SetCardinality(count);
+}
+
 static void TeradataQueryExec(ClientContext &context, TableFunctionInput &data, DataChunk &output) {
 	auto &state = data.global_state->Cast<TeradataQueryState>();
+	auto &bind_data = data.bind_data->Cast<TeradataBindData>();
+
+	if (!state.td_query) {
+		// The query was deferred until the join keys were shipped
+		state.td_query = TeradataQueryStart(bind_data, state, state.request_sql);
+		state.td_query->InitScanChunk(state.scan_chunk);
+	}
 
 	// Scan the query result.
 	state.td_query->Scan(state.scan_chunk);
+	CastScanChunk(bind_data, state, state.scan_chunk, output);
 
-	// Get the scan count
-	const auto count = state.scan_chunk.size();
-
-	// Cast all vectors
-	// For most types, this is a no-op, the target just references the source.
-	// But there are some special cases, like TIMESTAMP that always gets transmitted as VARCHAR.
-	for (idx_t output_idx = 0; output_idx < state.scan_chunk.ColumnCount(); output_idx++) {
-		const auto col_idx = state.column_ids[output_idx];
-
-		if (col_idx == COLUMN_IDENTIFIER_ROW_ID) {
-			throw InvalidInputException("Teradata query does not support the row id column (rowid)");
+	if (!state.local_filter_executor) {
+		return;
+	}
+	// Keep scanning until a row passes the filters, as an empty chunk ends the scan
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	while (output.size() > 0) {
+		const auto count = state.local_filter_executor->SelectExpression(output, sel);
+		if (count > 0) {
+			output.Slice(sel, count);
+			return;
 		}
-
-		auto &source = state.scan_chunk.data[col_idx]; // col ids
-		auto &target = output.data[output_idx];
-
-		VectorOperations::DefaultCast(source, target, count);
+		output.Reset();
+		state.td_query->Scan(state.scan_chunk);
+		CastScanChunk(bind_data, state, state.scan_chunk, output);
 	}
+}
 
-	output.SetCardinality(count);
+//----------------------------------------------------------------------------------------------------------------------
+// Dynamic To String
+//----------------------------------------------------------------------------------------------------------------------
+static InsertionOrderPreservingMap<string> TeradataQueryDynamicToString(TableFunctionDynamicToStringInput &input) {
+	InsertionOrderPreservingMap<string> result;
+	if (!input.global_state) {
+		return result;
+	}
+	auto &state = input.global_state->Cast<TeradataQueryState>();
+	if (!state.request_sql.empty()) {
+		result["Teradata Query"] = state.request_sql;
+	}
+	return result;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -211,6 +768,10 @@ TableFunction TeradataQueryFunction::GetFunction() {
 	TableFunction function;
 	function.name = "teradata_query";
 	function.arguments = {LogicalType::VARCHAR, LogicalType::VARCHAR};
+	// Any further arguments are bound to the "?" placeholders of the query
+	function.varargs = LogicalType::ANY;
+	function.named_parameters["estimate"] = LogicalType::BOOLEAN;
+	function.named_parameters["access_lock"] = LogicalType::BOOLEAN;
 
 	function.bind = TeradataQueryBind;
 	function.init_global = TeradataQueryInit;
@@ -218,6 +779,10 @@ TableFunction TeradataQueryFunction::GetFunction() {
 	function.get_bind_info = TeradataQueryBindInfo;
 	function.projection_pushdown = true;
 	function.filter_pushdown = true;
+	function.pushdown_complex_filter = TeradataQueryPushdownComplexFilter;
+	function.cardinality = TeradataQueryCardinality;
+	function.statistics = TeradataQueryStatistics;
+	function.dynamic_to_string = TeradataQueryDynamicToString;
 
 	return function;
 }
@@ -1,12 +1,14 @@
 #pragma once
 #include "teradata_catalog.hpp"
 #include "teradata_type.hpp"
+#include "teradata_parameters.hpp"
 
 namespace duckdb {
 
 class DatabaseInstance;
 class ExtensionLoader;
 class TeradataTableEntry;
+class TeradataShippedKeys;
 
 class TeradataBindData final : public TableFunctionData {
 public:
@@ -21,6 +23,31 @@ public:
 	bool is_read_only = false;
 	bool is_materialized = false;
 
+	// Whether the rows are written back into the same database, in which case they are read within the transaction
+	bool read_in_transaction = false;
+
+	// Whether the query has a top-level ORDER BY (without TOP). It is then sent as-is, as wrapping it as a derived
+	// table would lose its order, and the filters and projections are applied locally instead.
+	bool is_ordered = false;
+
+	// Whether to read with an ACCESS lock, i.e. without waiting for (or blocking) writers of the scanned tables
+	bool access_lock = false;
+
+	// Parameters bound to the placeholders of the SQL, passed along with the request
+	TeradataParameters parameters;
+
+	// Filters on (expressions of) multiple columns, transpiled to Teradata SQL
+	vector<string> complex_filters;
+
+	// The number of rows the Teradata optimizer estimates the query to return, if requested
+	optional_idx estimated_cardinality;
+
+	// Join keys shipped to Teradata to filter this scan with, if any
+	shared_ptr<TeradataShippedKeys> shipped_keys;
+
+	//! The SQL to reference the scanned table in the FROM clause of a query. Queries are referenced as a derived table.
+	string GetSourceSQL(const string &alias) const;
+
 	void SetCatalog(TeradataCatalog &catalog) {
 		this->catalog = &catalog;
 	}
@@ -2,6 +2,7 @@
 #include "teradata_type.hpp"
 #include "teradata_connection.hpp"
 #include "teradata_column_writer.hpp"
+#include "teradata_column_reader.hpp"
 
 #include "util/binary_reader.hpp"
 
@@ -57,13 +58,28 @@ void TeradataRequestContext::Init(const TeradataConnection &con) {
 void TeradataRequestContext::Execute(const string &sql) {
 	BeginRequest(sql, 'E');
 
-	MatchParcel(PclENDSTATEMENT);
-
-	EndRequest();
+	// The request may consist of multiple statements, each ending with its own PclENDSTATEMENT
+	while (true) {
+		const auto parcel = FetchParcel();
+		switch (parcel) {
+		case PclSUCCESS:
+		case PclENDSTATEMENT:
+			break;
+		case PclDATAINFO:
+		case PclRECORD:
+			// Discard the rows of any statement returning data
+			break;
+		case PclENDREQUEST:
+			is_open = false;
+			return;
+		default:
+			throw IOException("Unexpected parcel flavor %d", parcel);
+		}
+	}
 }
 
-void TeradataRequestContext::Execute(const string &sql, DataChunk &chunk, ArenaAllocator &arena,
-                                     vector<unique_ptr<TeradataColumnWriter>> &writers) {
+void TeradataRequestContext::SetUsingData(DataChunk &chunk, ArenaAllocator &arena,
+                                          vector<unique_ptr<TeradataColumnWriter>> &writers) {
 
 	const auto row_count = chunk.size();
 	const auto col_count = chunk.ColumnCount();
@@ -122,6 +138,13 @@ void TeradataRequestContext::Execute(const string &sql, DataChunk &chunk, ArenaA
 	dbc.using_data_count = row_count;
 
 	dbc.change_opts = 'Y';
+}
+
+void TeradataRequestContext::Execute(const string &sql, DataChunk &chunk, ArenaAllocator &arena,
+                                     vector<unique_ptr<TeradataColumnWriter>> &writers) {
+
+	SetUsingData(chunk, arena, writers);
+
 	BeginRequest(sql, 'E');
 
 	MatchParcel(PclENDSTATEMENT);
@@ -134,6 +157,89 @@ void TeradataRequestContext::Execute(const string &sql, DataChunk &chunk, ArenaA
 	EndRequest();
 }
 
+void TeradataRequestContext::QueryEach(const string &sql, DataChunk &chunk, ArenaAllocator &arena,
+                                       vector<unique_ptr<TeradataColumnWriter>> &writers,
+                                       ColumnDataCollection &result) {
+
+	SetUsingData(chunk, arena, writers);
+
+	BeginRequest(sql, 'E');
+
+	// The first column of the result is the index of the parameter row, the rest are the queried columns
+	const auto &result_types = result.Types();
+	const auto col_count = result_types.size() - 1;
+
+	vector<TeradataType> types;
+	vector<unique_ptr<TeradataColumnReader>> readers;
+	DataChunk fetch_chunk;
+
+	DataChunk result_chunk;
+	result_chunk.Initialize(Allocator::DefaultAllocator(), result_types);
+
+	idx_t stmt_idx = 0;
+	idx_t row_idx = 0;
+
+	const auto flush = [&]() {
+		if (row_idx == 0) {
+			return;
+		}
+		// Cast to the expected types, e.g. TIMESTAMP gets transmitted as VARCHAR
+		for (idx_t col_idx = 0; col_idx < col_count; col_idx++) {
+			VectorOperations::DefaultCast(fetch_chunk.data[col_idx], result_chunk.data[col_idx + 1], row_idx);
+		}
+		result_chunk.SetCardinality(row_idx);
+		result.Append(result_chunk);
+		result_chunk.Reset();
+		fetch_chunk.Reset();
+		row_idx = 0;
+	};
+
+	while (true) {
+		const auto parcel = FetchParcel();
+		switch (parcel) {
+		case PclSUCCESS:
+			// The next statement (parameter row) starts
+			break;
+		case PclDATAINFO: {
+			if (!readers.empty()) {
+				break;
+			}
+			ReadDataInfo(types);
+			if (types.size() != col_count) {
+				throw IOException("Expected %d columns in Teradata result, got %d", col_count, types.size());
+			}
+			vector<LogicalType> fetch_types;
+			for (auto &td_type : types) {
+				readers.push_back(TeradataColumnReader::Make(td_type));
+				fetch_types.push_back(td_type.ToDuckDB());
+			}
+			fetch_chunk.Initialize(Allocator::DefaultAllocator(), fetch_types);
+		} break;
+		case PclRECORD: {
+			if (readers.empty()) {
+				throw IOException("Received Teradata record without data info");
+			}
+			ReadRecord(fetch_chunk, readers, row_idx);
+			FlatVector::GetData<uint32_t>(result_chunk.data[0])[row_idx] = UnsafeNumericCast<uint32_t>(stmt_idx);
+
+			row_idx++;
+			if (row_idx == STANDARD_VECTOR_SIZE) {
+				flush();
+			}
+		} break;
+		case PclENDSTATEMENT:
+			stmt_idx++;
+			break;
+		case PclENDREQUEST:
+			flush();
+			is_open = false;
+			return;
+		default:
+			throw IOException("Unexpected parcel flavor %d", parcel);
+		}
+	}
+}
+
 enum class TeradataColumnTypeVariant { STANDARD, NULLABLE, PARAM_IN, PARAM_INOUT, PARAM_OUT };
 
 struct TeradataColumnType {
@@ -407,7 +513,20 @@ void TeradataRequestContext::Query(const string &sql, vector<TeradataType> &type
 	}
 
 	// Now parse the data info and set types
-	// TODO:
+	ReadDataInfo(types);
+}
+
+void TeradataRequestContext::Query(const string &sql, DataChunk &params, ArenaAllocator &arena,
+                                   vector<unique_ptr<TeradataColumnWriter>> &writers, vector<TeradataType> &types) {
+	D_ASSERT(params.size() == 1);
+
+	// The using data is sent along when initiating the request, so the arena only needs to outlive this call
+	SetUsingData(params, arena, writers);
+
+	Query(sql, types);
+}
+
+void TeradataRequestContext::ReadDataInfo(vector<TeradataType> &types) {
 	BinaryReader reader(buffer.data(), dbc.fet_ret_data_len);
 
 	// Read the number of columns
@@ -525,29 +644,8 @@ bool TeradataRequestContext::Fetch(DataChunk &chunk, const vector<unique_ptr<Ter
 
 		switch (parcel) {
 		case PclRECORD: {
-			// Offset null bytes
-			const auto null_bytes = (chunk.ColumnCount() + 7) / 8;
-			const auto data_ptr = buffer.data() + null_bytes;
-			const auto data_len = dbc.fet_ret_data_len;
-
 			// Parse the record
-			BinaryReader reader(data_ptr, data_len);
-
-			for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
-				// The NullIndicators Field contains one bit for each item in the DataField,
-				// stored in the minimum number of 8-bit bytes required to hold them,
-				// with the unused bits in the rightmost byte set to zero.
-				// Each bit is matched on a positional basis to an item in the Data Field.
-				// That is, the ith bit in the NullIndicators Field corresponds to the ith item in the Data Field.
-				const auto byte_idx = col_idx / 8;
-				const auto bit_idx = (7 - (col_idx % 8));
-				const bool is_null = (buffer[byte_idx] & (1 << bit_idx)) != 0;
-
-				auto &col_vec = chunk.data[col_idx];
-
-				// Call the reader to decode the column
-				readers[col_idx]->Decode(reader, col_vec, row_idx, is_null);
-			}
+			ReadRecord(chunk, readers, row_idx);
 
 			// Increment row id
 			row_idx++;
@@ -567,6 +665,99 @@ bool TeradataRequestContext::Fetch(DataChunk &chunk, const vector<unique_ptr<Ter
 	return true;
 }
 
+void TeradataRequestContext::ReadRecord(DataChunk &chunk, const vector<unique_ptr<TeradataColumnReader>> &readers,
+                                        idx_t row_idx) {
+	// Offset null bytes
+	const auto null_bytes = (chunk.ColumnCount() + 7) / 8;
+	const auto data_ptr = buffer.data() + null_bytes;
+	const auto data_len = dbc.fet_ret_data_len;
+
+	BinaryReader reader(data_ptr, data_len);
+
+	for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
+		// The NullIndicators Field contains one bit for each item in the DataField,
+		// stored in the minimum number of 8-bit bytes required to hold them,
+		// with the unused bits in the rightmost byte set to zero.
+		// Each bit is matched on a positional basis to an item in the Data Field.
+		// That is, the ith bit in the NullIndicators Field corresponds to the ith item in the Data Field.
+		const auto byte_idx = col_idx / 8;
+		const auto bit_idx = (7 - (col_idx % 8));
+		const bool is_null = (buffer[byte_idx] & (1 << bit_idx)) != 0;
+
+		auto &col_vec = chunk.data[col_idx];
+
+		// Call the reader to decode the column
+		readers[col_idx]->Decode(reader, col_vec, row_idx, is_null);
+	}
+}
+
+void TeradataRequestContext::QueryBatch(const string &sql, vector<vector<TeradataType>> &types,
+                                        vector<unique_ptr<ColumnDataCollection>> &results) {
+	BeginRequest(sql, 'E');
+
+	// The state of the statement currently being received
+	vector<TeradataType> stmt_types;
+	unique_ptr<ColumnDataCollection> stmt_result;
+	vector<unique_ptr<TeradataColumnReader>> readers;
+	DataChunk chunk;
+	idx_t row_idx = 0;
+
+	const auto flush = [&]() {
+		if (row_idx == 0) {
+			return;
+		}
+		chunk.SetCardinality(row_idx);
+		stmt_result->Append(chunk);
+		chunk.Reset();
+		row_idx = 0;
+	};
+
+	while (true) {
+		const auto parcel = FetchParcel();
+		switch (parcel) {
+		case PclSUCCESS:
+			// The next statement starts
+			break;
+		case PclDATAINFO: {
+			ReadDataInfo(stmt_types);
+			vector<LogicalType> duck_types;
+			for (auto &td_type : stmt_types) {
+				readers.push_back(TeradataColumnReader::Make(td_type));
+				duck_types.push_back(td_type.ToDuckDB());
+			}
+			stmt_result = make_uniq<ColumnDataCollection>(Allocator::DefaultAllocator(), duck_types);
+			chunk.Initialize(Allocator::DefaultAllocator(), duck_types);
+		} break;
+		case PclRECORD: {
+			if (!stmt_result) {
+				throw IOException("Received Teradata record without data info");
+			}
+			ReadRecord(chunk, readers, row_idx);
+			row_idx++;
+			if (row_idx == chunk.GetCapacity()) {
+				flush();
+			}
+		} break;
+		case PclENDSTATEMENT: {
+			// Statements without a result set (e.g. DDL) have no data info, and no result
+			if (stmt_result) {
+				flush();
+				chunk.Destroy();
+			}
+			types.push_back(std::move(stmt_types));
+			results.push_back(std::move(stmt_result));
+			stmt_types.clear();
+			readers.clear();
+		} break;
+		case PclENDREQUEST:
+			is_open = false;
+			return;
+		default:
+			throw IOException("Unexpected parcel flavor %d", parcel);
+		}
+	}
+}
+
 unique_ptr<ColumnDataCollection> TeradataRequestContext::FetchAll(const vector<TeradataType> &types) {
 	if (!is_open) {
 		throw IOException("Teradata request is not open");
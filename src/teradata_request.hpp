@@ -23,12 +23,26 @@ public:
 	void Execute(const string &sql, DataChunk &chunk, ArenaAllocator &arena,
 	             vector<unique_ptr<TeradataColumnWriter>> &writers);
 
+	// Execute a parameterized query, once for each row in the chunk, and collect the result rows of all of them.
+	// The first (UINTEGER) column of the result holds the index of the parameter row that produced each row
+	void QueryEach(const string &sql, DataChunk &chunk, ArenaAllocator &arena,
+	               vector<unique_ptr<TeradataColumnWriter>> &writers, ColumnDataCollection &result);
+
 	// Prepare a statement, returning the types of the result set
 	void Prepare(const string &sql, vector<TeradataType> &types, vector<string> &names);
 
 	// Issue a SQL query and return the types of the result set
 	void Query(const string &sql, vector<TeradataType> &types);
 
+	// Issue a parameterized SQL query, with the parameters in the single row of the chunk
+	void Query(const string &sql, DataChunk &params, ArenaAllocator &arena,
+	           vector<unique_ptr<TeradataColumnWriter>> &writers, vector<TeradataType> &types);
+
+	// Issue a multi-statement request, materializing the result of each statement in a single round trip.
+	// Statements without a result set (e.g. DDL) get no types and a nullptr result
+	void QueryBatch(const string &sql, vector<vector<TeradataType>> &types,
+	                vector<unique_ptr<ColumnDataCollection>> &results);
+
 	// Fetch the next data chunk after calling Query. Returns true if there is more data to fetch
 	bool Fetch(DataChunk &chunk, const vector<unique_ptr<TeradataColumnReader>> &readers);
 
@@ -37,6 +51,9 @@ public:
 	~TeradataRequestContext();
 
 private:
+	void SetUsingData(DataChunk &chunk, ArenaAllocator &arena, vector<unique_ptr<TeradataColumnWriter>> &writers);
+	void ReadDataInfo(vector<TeradataType> &types);
+	void ReadRecord(DataChunk &chunk, const vector<unique_ptr<TeradataColumnReader>> &readers, idx_t row_idx);
 	void BeginRequest(const string &sql, char mode);
 	void EndRequest();
 	void Close();
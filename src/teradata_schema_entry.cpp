@@ -95,6 +95,24 @@ optional_ptr<CatalogEntry> TeradataSchemaEntry::LookupEntry(CatalogTransaction t
 	}
 }
 
+SimilarCatalogEntry TeradataSchemaEntry::GetSimilarEntry(CatalogTransaction transaction,
+                                                         const EntryLookupInfo &lookup_info) {
+	if (lookup_info.GetCatalogType() != CatalogType::TABLE_ENTRY) {
+		return SchemaCatalogEntry::GetSimilarEntry(transaction, lookup_info);
+	}
+	// Suggesting a table for a name that was not found only needs the names of the tables. Scanning the entries would
+	// load the columns of all tables whose columns have not been loaded yet.
+	SimilarCatalogEntry result;
+	tables.ScanNames(transaction.GetContext(), [&](const string &table_name) {
+		const auto score = StringUtil::SimilarityRating(table_name, lookup_info.GetEntryName());
+		if (score > result.score) {
+			result.score = score;
+			result.name = table_name;
+		}
+	});
+	return result;
+}
+
 void TeradataSchemaEntry::DropEntry(ClientContext &context, DropInfo &info) {
 	info.schema = name;
 	switch (info.type) {
@@ -110,6 +128,25 @@ void TeradataSchemaEntry::Alter(CatalogTransaction transaction, AlterInfo &info)
 	throw NotImplementedException("TeradataSchemaEntry::Alter");
 }
 
+vector<string> TeradataSchemaEntry::GetPrimaryIndex(ClientContext &context, const string &table_name) {
+	return indexes.GetPrimaryIndex(context, table_name);
+}
+
+void TeradataSchemaEntry::Refresh(ClientContext &context) {
+	tables.Refresh(context);
+	indexes.Refresh(context);
+}
+
+void TeradataSchemaEntry::SetPrefetchedMetadata(unique_ptr<TeradataQueryResult> table_versions_p,
+                                                unique_ptr<TeradataQueryResult> indexes_p) {
+	if (table_versions_p) {
+		tables.SetPrefetchedVersions(std::move(table_versions_p));
+	}
+	if (indexes_p) {
+		indexes.SetPrefetchedIndexes(std::move(indexes_p));
+	}
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // Built-in Functions
 //----------------------------------------------------------------------------------------------------------------------
@@ -31,9 +31,19 @@ public:
 	optional_ptr<CatalogEntry> CreateCollation(CatalogTransaction transaction, CreateCollationInfo &info) override;
 	optional_ptr<CatalogEntry> CreateType(CatalogTransaction transaction, CreateTypeInfo &info) override;
 	optional_ptr<CatalogEntry> LookupEntry(CatalogTransaction transaction, const EntryLookupInfo &lookup_info) override;
+	SimilarCatalogEntry GetSimilarEntry(CatalogTransaction transaction, const EntryLookupInfo &lookup_info) override;
 	void DropEntry(ClientContext &context, DropInfo &info) override;
 	void Alter(CatalogTransaction transaction, AlterInfo &info) override;
 
+	// Get the columns of the primary index of a table in this schema
+	vector<string> GetPrimaryIndex(ClientContext &context, const string &table_name);
+
+	// Reload the tables (and indexes) in this schema that have changed in Teradata
+	void Refresh(ClientContext &context);
+
+	// Hand over the tables and indexes of this schema, fetched along with the schema itself
+	void SetPrefetchedMetadata(unique_ptr<TeradataQueryResult> table_versions, unique_ptr<TeradataQueryResult> indexes);
+
 private:
 	TeradataTableSet tables;
 	TeradataIndexSet indexes;
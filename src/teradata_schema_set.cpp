@@ -14,7 +14,7 @@ void TeradataSchemaSet::LoadEntries(ClientContext &context) {
 	const auto &td_catalog = catalog.Cast<TeradataCatalog>();
 
 	// We have to issue a query to get the list of schemas
-	auto &conn = td_catalog.GetConnection();
+	auto &conn = td_catalog.GetMetadataConnection();
 
 	// Select the schema name and the comment string
 	// TODO: Do something like this to pull in the immediate children of the database as schemas
@@ -25,7 +25,25 @@ void TeradataSchemaSet::LoadEntries(ClientContext &context) {
 	string query = "SELECT DatabaseName, CommentString FROM DBC.DatabasesV";
 	query += " WHERE DatabaseName = " + KeywordHelper::WriteQuoted(schema_to_load);
 
-	const auto result = conn.Query(query, false);
+	// The tables and indexes of the schema are needed right after, so fetch them in the same request instead of
+	// paying a round trip for each. The tables come from the local catalog snapshot instead, if we have one.
+	vector<string> statements;
+	statements.push_back(query);
+	statements.push_back(TeradataIndexSet::GetIndexQuery(schema_to_load));
+
+	const auto cache = td_catalog.GetCatalogCache();
+	const auto fetch_tables = !cache || !cache->HasColumns(schema_to_load);
+	if (fetch_tables) {
+		statements.push_back(TeradataTableSet::GetTableVersionsQuery(schema_to_load));
+	}
+
+	auto results = conn.QueryBatch(statements);
+	auto &result = results[0];
+	auto indexes = std::move(results[1]);
+	unique_ptr<TeradataQueryResult> table_versions;
+	if (fetch_tables) {
+		table_versions = std::move(results[2]);
+	}
 
 	// Now iterate over the result and create the schema entries
 	for (auto &chunk : result->Chunks()) {
@@ -45,6 +63,9 @@ void TeradataSchemaSet::LoadEntries(ClientContext &context) {
 
 			// Pass the entry along
 			auto entry = make_uniq<TeradataSchemaEntry>(catalog, info);
+			if (StringUtil::CIEquals(name, schema_to_load)) {
+				entry->SetPrefetchedMetadata(std::move(table_versions), std::move(indexes));
+			}
 			CreateEntry(std::move(entry));
 		}
 	}
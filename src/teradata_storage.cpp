@@ -4,6 +4,7 @@
 #include "teradata_transcation_manager.hpp"
 
 #include "duckdb/main/secret/secret_manager.hpp"
+#include "duckdb/common/file_system.hpp"
 
 namespace duckdb {
 
@@ -74,6 +75,18 @@ static unique_ptr<Catalog> TeradataAttach(optional_ptr<StorageExtensionInfo> sto
 		buffer_size = UnsafeNumericCast<idx_t>(buffer_size_int);
 	}
 
+	string catalog_cache_dir;
+	auto catalog_cache_dir_opt = options.find("catalog_cache_dir");
+	if (catalog_cache_dir_opt != options.end()) {
+		catalog_cache_dir = catalog_cache_dir_opt->second.get().ToString();
+	}
+
+	bool access_lock = false;
+	auto access_lock_opt = options.find("access_lock");
+	if (access_lock_opt != options.end()) {
+		access_lock = BooleanValue::Get(access_lock_opt->second.get().DefaultCastAs(LogicalType::BOOLEAN));
+	}
+
 	// Lastly, parse parameters from the logon string
 	if (!info.path.empty()) {
 
@@ -142,6 +155,15 @@ static unique_ptr<Catalog> TeradataAttach(optional_ptr<StorageExtensionInfo> sto
 	// Set the database path
 	result->GetConnection().Execute("DATABASE " + KeywordHelper::WriteOptionallyQuoted(database) + ";");
 
+	result->SetAccessLock(access_lock);
+
+	// Load the tables from a local snapshot of the catalog, if enabled
+	if (!catalog_cache_dir.empty()) {
+		auto &fs = FileSystem::GetFileSystem(context);
+		const auto cache_path = TeradataCatalogCache::GetCachePath(fs, catalog_cache_dir, host, user, database);
+		result->SetCatalogCache(make_uniq<TeradataCatalogCache>(fs, cache_path));
+	}
+
 	return std::move(result);
 }
 
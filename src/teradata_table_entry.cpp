@@ -2,9 +2,11 @@
 #include "teradata_catalog.hpp"
 #include "teradata_transaction.hpp"
 #include "teradata_query.hpp"
+#include "teradata_connection.hpp"
 
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
 
 namespace duckdb {
 
@@ -22,10 +24,121 @@ TeradataTableEntry::TeradataTableEntry(Catalog &catalog, SchemaCatalogEntry &sch
 	D_ASSERT(teradata_types.size() == columns.LogicalColumnCount());
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// Statistics
+//----------------------------------------------------------------------------------------------------------------------
+static bool UseStatistics(ClientContext &context) {
+	Value use_statistics_value;
+	if (context.TryGetCurrentSetting("teradata_use_statistics", use_statistics_value)) {
+		return use_statistics_value.GetValue<bool>();
+	}
+	return true;
+}
+
+static unique_ptr<TeradataTableStatistics> LoadTableStatistics(TeradataConnection &conn, const string &schema_name,
+                                                               const string &table_name) {
+	// The row count is recorded with every statistic of the table, use the most recent one.
+	// Multi-column statistics are skipped, we only keep statistics on single columns.
+	const auto query = StringUtil::Format(
+	    "SELECT ColumnName, CAST(RowCount AS BIGINT), CAST(UniqueValueCount AS BIGINT), CAST(NullCount AS BIGINT) "
+	    "FROM DBC.StatsV WHERE DatabaseName = %s AND TableName = %s "
+	    "ORDER BY LastCollectTimeStamp;",
+	    KeywordHelper::WriteQuoted(schema_name, '\''), KeywordHelper::WriteQuoted(table_name, '\''));
+
+	const auto result = conn.Query(query, false);
+
+	auto stats = make_uniq<TeradataTableStatistics>();
+	bool has_stats = false;
+
+	for (auto &chunk : result->Chunks()) {
+		chunk.Flatten();
+
+		const auto count = chunk.size();
+
+		const auto &col_name_vec = chunk.data[0];
+		const auto &row_count_vec = chunk.data[1];
+		const auto &ndv_count_vec = chunk.data[2];
+		const auto &null_count_vec = chunk.data[3];
+
+		const auto col_names = FlatVector::GetData<string_t>(col_name_vec);
+		const auto row_counts = FlatVector::GetData<int64_t>(row_count_vec);
+		const auto ndv_counts = FlatVector::GetData<int64_t>(ndv_count_vec);
+		const auto null_counts = FlatVector::GetData<int64_t>(null_count_vec);
+
+		for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+			if (FlatVector::IsNull(row_count_vec, row_idx) || row_counts[row_idx] < 0) {
+				continue;
+			}
+
+			has_stats = true;
+			stats->row_count = UnsafeNumericCast<idx_t>(row_counts[row_idx]);
+
+			// Table level (summary) statistics have no column name
+			if (FlatVector::IsNull(col_name_vec, row_idx) || FlatVector::IsNull(ndv_count_vec, row_idx)) {
+				continue;
+			}
+
+			// Multi-column statistics list their columns separated by commas
+			auto col_name = col_names[row_idx].GetString();
+			StringUtil::Trim(col_name);
+			if (col_name.empty() || col_name.find(',') != string::npos) {
+				continue;
+			}
+
+			TeradataColumnStatistics col_stats;
+			col_stats.distinct_count = UnsafeNumericCast<idx_t>(MaxValue<int64_t>(ndv_counts[row_idx], 0));
+			if (!FlatVector::IsNull(null_count_vec, row_idx)) {
+				col_stats.null_count = UnsafeNumericCast<idx_t>(MaxValue<int64_t>(null_counts[row_idx], 0));
+			}
+			stats->columns[col_name] = col_stats;
+		}
+	}
+
+	if (!has_stats) {
+		return nullptr;
+	}
+	return stats;
+}
+
+optional_ptr<TeradataTableStatistics> TeradataTableEntry::GetTableStatistics(ClientContext &context) {
+	if (!UseStatistics(context)) {
+		return nullptr;
+	}
+
+	lock_guard<mutex> guard(statistics_lock);
+	if (!statistics_loaded) {
+		auto &td_catalog = catalog.Cast<TeradataCatalog>();
+		statistics = LoadTableStatistics(td_catalog.GetMetadataConnection(), schema.name, name);
+		statistics_loaded = true;
+	}
+	return statistics.get();
+}
+
 unique_ptr<BaseStatistics> TeradataTableEntry::GetStatistics(ClientContext &context, column_t column_id) {
-	return nullptr;
+	if (column_id >= columns.LogicalColumnCount()) {
+		return nullptr;
+	}
+	const auto stats = GetTableStatistics(context);
+	if (!stats) {
+		return nullptr;
+	}
+	auto &col = columns.GetColumn(LogicalIndex(column_id));
+	const auto entry = stats->columns.find(col.GetName());
+	if (entry == stats->columns.end()) {
+		return nullptr;
+	}
+
+	// Teradata does not expose the min/max of a column in a portable form (they are part of the encoded histogram),
+	// and the statistics may be stale, so only provide the distinct count as an estimate and leave the rest unknown.
+	auto result = BaseStatistics::CreateUnknown(col.GetType());
+	result.SetDistinctCount(entry->second.distinct_count);
+	return result.ToUnique();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// Scan
+//----------------------------------------------------------------------------------------------------------------------
+
 TableFunction TeradataTableEntry::GetScanFunction(ClientContext &context, unique_ptr<FunctionData> &bind_data) {
 	auto &td_catalog = catalog.Cast<TeradataCatalog>();
 	auto &transaction = TeradataTransaction::Get(context, catalog);
@@ -45,6 +158,7 @@ TableFunction TeradataTableEntry::GetScanFunction(ClientContext &context, unique
 	}
 
 	result->is_read_only = transaction.IsReadOnly();
+	result->access_lock = td_catalog.UseAccessLock(context);
 	result->is_materialized = false;
 	result->td_types = teradata_types;
 
@@ -6,6 +6,19 @@
 
 namespace duckdb {
 
+// Statistics of a single column, as collected by COLLECT STATISTICS in Teradata
+struct TeradataColumnStatistics {
+	idx_t distinct_count = 0;
+	idx_t null_count = 0;
+};
+
+// The collected statistics of a Teradata table. These are only as fresh as the last COLLECT STATISTICS, so they are
+// only ever used as estimates, never to make assumptions about the actual contents of the table.
+struct TeradataTableStatistics {
+	idx_t row_count = 0;
+	case_insensitive_map_t<TeradataColumnStatistics> columns;
+};
+
 class TeradataTableInfo final : public CreateTableInfo {
 public:
 	// If we are populating a table entry from an existing teradata table, we also pass on the teradata types
@@ -29,9 +42,18 @@ public:
 	//! Returns the storage info of this table
 	TableStorageInfo GetStorageInfo(ClientContext &context) override;
 
+	// Get the collected statistics of the table, loading them from Teradata on first use.
+	// Returns nullptr if no statistics have been collected for the table.
+	optional_ptr<TeradataTableStatistics> GetTableStatistics(ClientContext &context);
+
 public:
 	// The raw teradata typess
 	vector<TeradataType> teradata_types;
+
+private:
+	mutex statistics_lock;
+	bool statistics_loaded = false;
+	unique_ptr<TeradataTableStatistics> statistics;
 };
 
 } // namespace duckdb
\ No newline at end of file
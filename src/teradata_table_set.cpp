@@ -143,14 +143,33 @@ optional_ptr<CatalogEntry> TeradataTableSet::CreateTable(ClientContext &context,
 	// Execute the sql statement
 	transaction.GetConnection().Execute(create_sql);
 
+	// The local catalog snapshot no longer reflects this schema
+	const auto cache = catalog.Cast<TeradataCatalog>().GetCatalogCache();
+	if (cache) {
+		cache->Invalidate(schema.name);
+	}
+
 	auto tbl_entry = make_uniq<TeradataTableEntry>(catalog, schema, base);
 	return CreateEntry(std::move(tbl_entry));
 }
 
-void TeradataTableSet::LoadEntries(ClientContext &context) {
-	const auto &td_catalog = catalog.Cast<TeradataCatalog>();
-
-	auto &conn = td_catalog.GetConnection();
+// Teradata limits the length of a request, so only list this many tables in a single query
+static constexpr idx_t MAX_TABLES_PER_QUERY = 256;
+
+vector<TeradataCachedColumn> TeradataTableSet::LoadColumns(TeradataConnection &conn, const string &schema_name,
+                                                           const vector<string> &table_names) {
+	if (table_names.size() > MAX_TABLES_PER_QUERY) {
+		vector<TeradataCachedColumn> columns;
+		for (idx_t offset = 0; offset < table_names.size(); offset += MAX_TABLES_PER_QUERY) {
+			const auto end = MinValue<idx_t>(offset + MAX_TABLES_PER_QUERY, table_names.size());
+			const vector<string> batch(table_names.begin() + offset, table_names.begin() + end);
+			auto batch_columns = LoadColumns(conn, schema_name, batch);
+			for (auto &column : batch_columns) {
+				columns.push_back(std::move(column));
+			}
+		}
+		return columns;
+	}
 
 	/*
 	    "The DBC.ColumnsV[X] views provide complete information for table columns but provide only limited information
@@ -161,20 +180,28 @@ void TeradataTableSet::LoadEntries(ClientContext &context) {
 	    DBC.TablesV view.
 	 */
 
+	string table_filter;
+	if (!table_names.empty()) {
+		vector<string> quoted_names;
+		for (auto &table_name : table_names) {
+			quoted_names.push_back(KeywordHelper::WriteQuoted(table_name, '\''));
+		}
+		table_filter = " AND T.TableName IN (" + StringUtil::Join(quoted_names, ", ") + ")";
+	}
+
 	// TODO: Sanitize the schema name
-	const auto query = StringUtil::Format("SELECT T.TableName, C.ColumnName, C.ColumnType, C.ColumnLength "
-	                                      "FROM dbc.TablesV AS T JOIN dbc.ColumnsV AS C "
-	                                      "ON T.TableName = C.TableName AND T.DatabaseName = C.DatabaseName "
-	                                      "WHERE T.DatabaseName = '%s' AND (T.TableKind = 'T' OR T.TableKind = 'O') "
-	                                      "ORDER BY T.TableName, C.ColumnId",
-	                                      schema.name);
+	const auto query = StringUtil::Format(
+	    "SELECT T.TableName, C.ColumnName, C.ColumnType, C.ColumnLength, "
+	    "CAST(COALESCE(T.LastAlterTimeStamp, T.CreateTimeStamp) AS VARCHAR(32)) "
+	    "FROM dbc.TablesV AS T JOIN dbc.ColumnsV AS C "
+	    "ON T.TableName = C.TableName AND T.DatabaseName = C.DatabaseName "
+	    "WHERE T.DatabaseName = '%s' AND (T.TableKind = 'T' OR T.TableKind = 'O')%s "
+	    "ORDER BY T.TableName, C.ColumnId",
+	    schema_name, table_filter);
 
 	const auto result = conn.Query(query, false);
 
-	TeradataTableInfo info;
-	info.schema = schema.name;
-
-	bool skip_table = false;
+	vector<TeradataCachedColumn> columns;
 
 	// Iterate over the chunks in the result
 	for (auto &chunk : result->Chunks()) {
@@ -184,48 +211,346 @@ void TeradataTableSet::LoadEntries(ClientContext &context) {
 		auto &col_name_vec = chunk.data[1];
 		auto &col_type_vec = chunk.data[2];
 		auto &col_size_vec = chunk.data[3];
+		auto &altered_vec = chunk.data[4];
 
 		for (idx_t row_idx = 0; row_idx < count; row_idx++) {
-			const auto tbl_name = FlatVector::GetData<string_t>(tbl_name_vec)[row_idx];
-			const auto col_name = FlatVector::GetData<string_t>(col_name_vec)[row_idx];
-			const auto col_type = FlatVector::GetData<string_t>(col_type_vec)[row_idx];
-			const auto col_size = FlatVector::GetData<int32_t>(col_size_vec)[row_idx];
-
-			if (tbl_name != info.table) {
-				// We have a new table
-				if (!info.table.empty() && !skip_table) {
-					// Finish the previous table
-					entries[info.table] = make_uniq<TeradataTableEntry>(catalog, schema, info);
-				}
-				skip_table = false;
+			TeradataCachedColumn column;
+			column.table_name = FlatVector::GetData<string_t>(tbl_name_vec)[row_idx].GetString();
+			column.column_name = FlatVector::GetData<string_t>(col_name_vec)[row_idx].GetString();
+			column.column_type = FlatVector::GetData<string_t>(col_type_vec)[row_idx].GetString();
+			column.column_length = FlatVector::GetData<int32_t>(col_size_vec)[row_idx];
+			if (!FlatVector::IsNull(altered_vec, row_idx)) {
+				column.last_altered = FlatVector::GetData<string_t>(altered_vec)[row_idx].GetString();
+			}
+			columns.push_back(std::move(column));
+		}
+	}
+
+	return columns;
+}
+
+string TeradataTableSet::GetTableVersionsQuery(const string &schema_name, const string &table_name) {
+	string table_filter;
+	if (!table_name.empty()) {
+		table_filter = " AND TableName = " + KeywordHelper::WriteQuoted(table_name, '\'');
+	}
+
+	// Listing the tables with the time they were last altered is cheap compared to loading all their columns
+	return StringUtil::Format("SELECT TableName, "
+	                          "CAST(COALESCE(LastAlterTimeStamp, CreateTimeStamp) AS VARCHAR(32)) "
+	                          "FROM dbc.TablesV "
+	                          "WHERE DatabaseName = %s AND (TableKind = 'T' OR TableKind = 'O')%s",
+	                          KeywordHelper::WriteQuoted(schema_name, '\''), table_filter);
+}
+
+unordered_map<string, string> TeradataTableSet::LoadTableVersions(TeradataConnection &conn, const string &schema_name,
+                                                                  const string &table_name) {
+	const auto result = conn.Query(GetTableVersionsQuery(schema_name, table_name), false);
+	return ReadTableVersions(*result);
+}
+
+unordered_map<string, string> TeradataTableSet::ReadTableVersions(TeradataQueryResult &result) {
+	unordered_map<string, string> versions;
+	for (auto &chunk : result.Chunks()) {
+		chunk.Flatten();
+		auto &tbl_name_vec = chunk.data[0];
+		auto &altered_vec = chunk.data[1];
+		for (idx_t row_idx = 0; row_idx < chunk.size(); row_idx++) {
+			const auto tbl_name = FlatVector::GetData<string_t>(tbl_name_vec)[row_idx].GetString();
+			string last_altered;
+			if (!FlatVector::IsNull(altered_vec, row_idx)) {
+				last_altered = FlatVector::GetData<string_t>(altered_vec)[row_idx].GetString();
+			}
+			versions[tbl_name] = std::move(last_altered);
+		}
+	}
+	return versions;
+}
+
+void TeradataTableSet::CreateTableEntries(const vector<TeradataCachedColumn> &columns,
+                                          const std::function<void(TeradataTableInfo &info)> &callback) {
+	TeradataTableInfo info;
+	info.schema = schema.name;
+
+	bool skip_table = false;
 
-				// Reset the info
-				info = TeradataTableInfo();
-				info.table = tbl_name.GetString();
-				info.schema = schema.name;
+	for (auto &column : columns) {
+		if (column.table_name != info.table) {
+			// We have a new table
+			if (!info.table.empty() && !skip_table) {
+				// Finish the previous table
+				callback(info);
 			}
+			skip_table = false;
 
-			// Add the columns
-			try {
-				TeradataType td_type = TeradataType::FromShortCode(col_type.GetData());
-				if (td_type.HasLengthModifier()) {
-					td_type.SetLength(col_size);
-				}
+			// Reset the info
+			info = TeradataTableInfo();
+			info.table = column.table_name;
+			info.schema = schema.name;
+
+			table_versions[column.table_name] = column.last_altered;
+		}
+
+		if (column.IsPlaceholder()) {
+			// The columns of this table have not been loaded yet, defer creating its entry until it is looked up
+			deferred_tables[column.table_name] = column.table_name;
+			skip_table = true;
+			continue;
+		}
 
-				const auto duck_type = td_type.ToDuckDB();
-				info.columns.AddColumn(ColumnDefinition(col_name.GetString(), duck_type));
-				info.teradata_types.push_back(td_type);
-			} catch (...) {
-				// Ignore the column type (and this table) for now, just make this work
-				skip_table = true;
+		// Add the columns
+		try {
+			TeradataType td_type = TeradataType::FromShortCode(column.column_type);
+			if (td_type.HasLengthModifier()) {
+				td_type.SetLength(column.column_length);
 			}
+
+			const auto duck_type = td_type.ToDuckDB();
+			info.columns.AddColumn(ColumnDefinition(column.column_name, duck_type));
+			info.teradata_types.push_back(td_type);
+		} catch (...) {
+			// Ignore the column type (and this table) for now, just make this work
+			skip_table = true;
 		}
 	}
 
 	if (!info.table.empty() && !skip_table) {
 		// Finish the last table
-		entries[info.table] = make_uniq<TeradataTableEntry>(catalog, schema, info);
+		callback(info);
+	}
+}
+
+void TeradataTableSet::UpdateSnapshot(const vector<string> &removed_tables,
+                                      const vector<TeradataCachedColumn> &added_columns) {
+	const auto cache = catalog.Cast<TeradataCatalog>().GetCatalogCache();
+	vector<TeradataCachedColumn> snapshot;
+	if (!cache || !cache->TryGetColumns(schema.name, snapshot)) {
+		return;
+	}
+
+	const unordered_set<string> removed(removed_tables.begin(), removed_tables.end());
+
+	vector<TeradataCachedColumn> updated;
+	for (auto &column : snapshot) {
+		if (removed.find(column.table_name) == removed.end()) {
+			updated.push_back(std::move(column));
+		}
+	}
+	for (auto &column : added_columns) {
+		updated.push_back(column);
+	}
+	// The columns of a table have to stay together, in order
+	std::stable_sort(updated.begin(), updated.end(), [](const TeradataCachedColumn &a, const TeradataCachedColumn &b) {
+		return a.table_name < b.table_name;
+	});
+	cache->SetColumns(schema.name, std::move(updated));
+}
+
+void TeradataTableSet::SetPrefetchedVersions(unique_ptr<TeradataQueryResult> result) {
+	prefetched_versions = std::move(result);
+}
+
+void TeradataTableSet::LoadEntries(ClientContext &context) {
+	auto &td_catalog = catalog.Cast<TeradataCatalog>();
+
+	table_versions.clear();
+	deferred_tables.clear();
+
+	// Only use a prefetched result once, reloading the entries has to go to Teradata again
+	const auto prefetched = std::move(prefetched_versions);
+
+	// Populate the tables from the local catalog snapshot if we have one
+	vector<TeradataCachedColumn> columns;
+	const auto cache = td_catalog.GetCatalogCache();
+	if (cache && cache->TryGetColumns(schema.name, columns)) {
+		CreateTableEntries(columns, [&](TeradataTableInfo &info) {
+			entry_map[info.table] = info.table;
+			entries[info.table] = make_uniq<TeradataTableEntry>(catalog, schema, info);
+		});
+		return;
+	}
+
+	// Otherwise, only list the tables for now. Loading the columns of every table in a large database takes a long
+	// time, so the columns of a table are only loaded when the table is first looked up.
+	const auto versions = prefetched ? ReadTableVersions(*prefetched)
+	                                 : LoadTableVersions(td_catalog.GetMetadataConnection(), schema.name);
+	for (auto &version : versions) {
+		columns.push_back(TeradataCachedColumn::Placeholder(version.first, version.second));
+	}
+	std::sort(columns.begin(), columns.end(), [](const TeradataCachedColumn &a, const TeradataCachedColumn &b) {
+		return a.table_name < b.table_name;
+	});
+	CreateTableEntries(columns, [&](TeradataTableInfo &info) {});
+
+	if (cache) {
+		cache->SetColumns(schema.name, std::move(columns));
+	}
+}
+
+void TeradataTableSet::LoadDeferredTables(const vector<string> &table_names,
+                                          const vector<TeradataCachedColumn> &columns) {
+	for (auto &table_name : table_names) {
+		deferred_tables.erase(table_name);
+	}
+	CreateTableEntries(columns, [&](TeradataTableInfo &info) {
+		ReplaceEntry(info.table, make_uniq<TeradataTableEntry>(catalog, schema, info));
+	});
+
+	UpdateSnapshot(table_names, columns);
+}
+
+optional_ptr<CatalogEntry> TeradataTableSet::ProbeEntry(ClientContext &context, const string &name) {
+	// DuckDB looks up unqualified names in every catalog on the search path, and a typo is usually retried a couple
+	// of times, so remember the names that do not exist for a while instead of asking Teradata every time
+	Value ttl_value;
+	idx_t ttl = 60;
+	if (context.TryGetCurrentSetting("teradata_missing_table_ttl", ttl_value)) {
+		ttl = ttl_value.GetValue<idx_t>();
+	}
+
+	const auto now = std::chrono::steady_clock::now();
+	const auto missing = missing_tables.find(name);
+	if (missing != missing_tables.end()) {
+		if (now - missing->second < std::chrono::seconds(ttl)) {
+			return nullptr;
+		}
+		missing_tables.erase(missing);
+	}
+
+	// The table may have been created since we listed the tables of the schema, check for just this name
+	auto &td_catalog = catalog.Cast<TeradataCatalog>();
+	const auto versions = LoadTableVersions(td_catalog.GetMetadataConnection(), schema.name, name);
+	if (versions.empty()) {
+		if (ttl > 0) {
+			missing_tables[name] = now;
+		}
+		return nullptr;
+	}
+
+	const auto &table_name = versions.begin()->first;
+	const vector<string> table_names {table_name};
+	LoadDeferredTables(table_names, LoadColumns(td_catalog.GetMetadataConnection(), schema.name, table_names));
+
+	const auto entry = entries.find(table_name);
+	if (entry == entries.end()) {
+		// The table exists, but can not be represented in DuckDB (e.g. because of unsupported column types)
+		if (ttl > 0) {
+			missing_tables[name] = now;
+		}
+		return nullptr;
+	}
+	return entry->second.get();
+}
+
+optional_ptr<CatalogEntry> TeradataTableSet::LoadDeferredEntry(ClientContext &context, const string &name) {
+	const auto deferred = deferred_tables.find(name);
+	if (deferred == deferred_tables.end()) {
+		return ProbeEntry(context, name);
+	}
+	const auto table_name = deferred->second;
+	const vector<string> table_names {table_name};
+
+	auto &td_catalog = catalog.Cast<TeradataCatalog>();
+	LoadDeferredTables(table_names, LoadColumns(td_catalog.GetMetadataConnection(), schema.name, table_names));
+
+	// The table may have been dropped since we listed it
+	const auto entry = entries.find(table_name);
+	if (entry == entries.end()) {
+		return nullptr;
+	}
+	return entry->second.get();
+}
+
+void TeradataTableSet::LoadDeferredEntries(ClientContext &context) {
+	if (deferred_tables.empty()) {
+		return;
+	}
+	vector<string> table_names;
+	for (auto &deferred : deferred_tables) {
+		table_names.push_back(deferred.second);
+	}
+
+	// When all tables are needed (e.g. to list them), loading the columns of the whole schema in one go is cheaper
+	// than listing the deferred tables in the query
+	auto &td_catalog = catalog.Cast<TeradataCatalog>();
+	const auto all_columns = LoadColumns(td_catalog.GetMetadataConnection(), schema.name);
+
+	vector<TeradataCachedColumn> columns;
+	for (auto &column : all_columns) {
+		if (deferred_tables.find(column.table_name) != deferred_tables.end()) {
+			columns.push_back(column);
+		}
+	}
+	LoadDeferredTables(table_names, columns);
+}
+
+void TeradataTableSet::ScanDeferredNames(const std::function<void(const string &)> &callback) {
+	for (auto &deferred : deferred_tables) {
+		callback(deferred.second);
+	}
+}
+
+void TeradataTableSet::RefreshEntries(ClientContext &context) {
+	auto &td_catalog = catalog.Cast<TeradataCatalog>();
+	auto &conn = td_catalog.GetMetadataConnection();
+
+	// Find the tables that were created, altered or dropped since we last loaded them
+	const auto current_versions = LoadTableVersions(conn, schema.name);
+	missing_tables.clear();
+
+	vector<string> changed_tables;
+	vector<string> reload_tables;
+	vector<TeradataCachedColumn> added_columns;
+	for (auto &entry : current_versions) {
+		const auto version = table_versions.find(entry.first);
+		if (version != table_versions.end() && version->second == entry.second) {
+			continue;
+		}
+		changed_tables.push_back(entry.first);
+		if (version == table_versions.end() || deferred_tables.find(entry.first) != deferred_tables.end()) {
+			// New tables, and tables whose columns have not been loaded yet, are (still) loaded when looked up
+			added_columns.push_back(TeradataCachedColumn::Placeholder(entry.first, entry.second));
+		} else {
+			reload_tables.push_back(entry.first);
+		}
+	}
+	vector<string> dropped_tables;
+	for (auto &entry : table_versions) {
+		if (current_versions.find(entry.first) == current_versions.end()) {
+			dropped_tables.push_back(entry.first);
+		}
+	}
+	if (changed_tables.empty() && dropped_tables.empty()) {
+		return;
+	}
+
+	for (auto &table_name : dropped_tables) {
+		ReplaceEntry(table_name, nullptr);
+		deferred_tables.erase(table_name);
+		table_versions.erase(table_name);
+	}
+	for (auto &table_name : changed_tables) {
+		ReplaceEntry(table_name, nullptr);
+	}
+
+	// Only reload the columns of the loaded tables that have changed
+	if (!reload_tables.empty()) {
+		auto columns = LoadColumns(conn, schema.name, reload_tables);
+		for (auto &column : columns) {
+			added_columns.push_back(std::move(column));
+		}
 	}
+	std::stable_sort(added_columns.begin(), added_columns.end(),
+	                 [](const TeradataCachedColumn &a, const TeradataCachedColumn &b) {
+		                 return a.table_name < b.table_name;
+	                 });
+	CreateTableEntries(added_columns, [&](TeradataTableInfo &info) {
+		ReplaceEntry(info.table, make_uniq<TeradataTableEntry>(catalog, schema, info));
+	});
+
+	// Update the local catalog snapshot in the same way
+	changed_tables.insert(changed_tables.end(), dropped_tables.begin(), dropped_tables.end());
+	UpdateSnapshot(changed_tables, added_columns);
 }
 
-} // namespace duckdb
\ No newline at end of file
+} // namespace duckdb
@@ -1,12 +1,18 @@
 #pragma once
 
 #include "teradata_catalog_set.hpp"
+#include "teradata_catalog_cache.hpp"
+#include "teradata_result.hpp"
+
+#include <chrono>
 
 namespace duckdb {
 
 struct BoundCreateTableInfo;
 
 class Catalog;
+class TeradataConnection;
+class TeradataTableInfo;
 
 class TeradataTableSet final : public TeradataInSchemaSet {
 public:
@@ -15,8 +21,46 @@ public:
 
 	optional_ptr<CatalogEntry> CreateTable(ClientContext &context, BoundCreateTableInfo &info);
 
+	// Load the columns of all tables in the schema (or only of the given tables) from the DBC views
+	static vector<TeradataCachedColumn> LoadColumns(TeradataConnection &conn, const string &schema_name,
+	                                                const vector<string> &table_names = vector<string>());
+
+	// List the tables in the schema (or only the given table), together with the time they were last altered
+	static unordered_map<string, string> LoadTableVersions(TeradataConnection &conn, const string &schema_name,
+	                                                       const string &table_name = string());
+	static string GetTableVersionsQuery(const string &schema_name, const string &table_name = string());
+	static unordered_map<string, string> ReadTableVersions(TeradataQueryResult &result);
+
+	// Hand over the result of the table versions query, fetched along with other metadata in the same request, to be
+	// used instead of querying the table versions when the entries are loaded
+	void SetPrefetchedVersions(unique_ptr<TeradataQueryResult> result);
+
 protected:
 	void LoadEntries(ClientContext &context) override;
+	void RefreshEntries(ClientContext &context) override;
+	optional_ptr<CatalogEntry> LoadDeferredEntry(ClientContext &context, const string &name) override;
+	void LoadDeferredEntries(ClientContext &context) override;
+	void ScanDeferredNames(const std::function<void(const string &)> &callback) override;
+
+private:
+	// Create the table infos from the columns of the tables, ordered by table
+	void CreateTableEntries(const vector<TeradataCachedColumn> &columns,
+	                        const std::function<void(TeradataTableInfo &info)> &callback);
+	// Load the columns of tables whose entries were deferred, and create their entries
+	void LoadDeferredTables(const vector<string> &table_names, const vector<TeradataCachedColumn> &columns);
+	// Check whether a table that is not known (yet) exists in Teradata, and load it if so
+	optional_ptr<CatalogEntry> ProbeEntry(ClientContext &context, const string &name);
+	// Replace the tables in the local catalog snapshot, if any
+	void UpdateSnapshot(const vector<string> &removed_tables, const vector<TeradataCachedColumn> &added_columns);
+
+	// When each known table was last altered in Teradata
+	unordered_map<string, string> table_versions;
+	// The tables whose columns have not been loaded yet, by their case insensitive name
+	case_insensitive_map_t<string> deferred_tables;
+	// The prefetched result of the table versions query, if any
+	unique_ptr<TeradataQueryResult> prefetched_versions;
+	// The names that were looked up but did not exist in Teradata, and when we last checked
+	case_insensitive_map_t<std::chrono::steady_clock::time_point> missing_tables;
 };
 
 } // namespace duckdb
\ No newline at end of file
@@ -1,13 +1,14 @@
 #include "teradata_transaction.hpp"
 #include "teradata_catalog.hpp"
+#include "teradata_connection.hpp"
+
+#include "duckdb/main/client_context.hpp"
 
 namespace duckdb {
 
 TeradataTransaction::TeradataTransaction(TeradataCatalog &catalog, TransactionManager &manager, ClientContext &context)
-    : Transaction(manager, context), con(catalog.GetConnection()) {
-
-	// TODO:
-	// transaction_state = TeradataTransactionState::TRANSACTION_NOT_YET_STARTED;
+    : Transaction(manager, context), con(catalog.GetConnection()),
+      transaction_state(TeradataTransactionState::TRANSACTION_NOT_YET_STARTED) {
 }
 
 TeradataTransaction::~TeradataTransaction() {
@@ -17,16 +18,76 @@ TeradataTransaction &TeradataTransaction::Get(ClientContext &context, Catalog &c
 	return Transaction::Get(context, catalog).Cast<TeradataTransaction>();
 }
 
-void TeradataTransaction::Start() {
+void TeradataTransaction::Start(ClientContext &context) {
+	if (context.transaction.IsAutoCommit()) {
+		// A single statement, the remote transaction is only started once it writes to Teradata, see GetConnection
+		transaction_state = TeradataTransactionState::TRANSACTION_NOT_YET_STARTED;
+		return;
+	}
+	// An explicit transaction has to hold the locks of its reads too, so that it can safely write based on them
 	con.Execute("BEGIN TRANSACTION;");
+	transaction_state = TeradataTransactionState::TRANSACTION_STARTED;
+}
+
+TeradataConnection &TeradataTransaction::GetConnection() {
+	lock_guard<mutex> guard(transaction_lock);
+	if (transaction_state == TeradataTransactionState::TRANSACTION_NOT_YET_STARTED) {
+		con.Execute("BEGIN TRANSACTION;");
+		transaction_state = TeradataTransactionState::TRANSACTION_STARTED;
+	}
+	return con;
+}
+
+bool TeradataTransaction::HasStarted() {
+	lock_guard<mutex> guard(transaction_lock);
+	return transaction_state == TeradataTransactionState::TRANSACTION_STARTED;
+}
+
+void TeradataTransaction::AddCleanup(string sql) {
+	lock_guard<mutex> guard(transaction_lock);
+	cleanup_statements.push_back(std::move(sql));
+}
+
+void TeradataTransaction::RunCleanup() {
+	auto statements = std::move(cleanup_statements);
+	cleanup_statements.clear();
+	for (auto &sql : statements) {
+		try {
+			con.Execute(sql);
+		} catch (std::exception &ex) {
+			// The transaction itself has ended fine, and whatever we failed to clean up (volatile tables) is gone
+			// once the session ends anyway
+		}
+	}
 }
 
 void TeradataTransaction::Commit() {
-	con.Execute("END TRANSACTION;");
+	lock_guard<mutex> guard(transaction_lock);
+	if (transaction_state == TeradataTransactionState::TRANSACTION_STARTED) {
+		transaction_state = TeradataTransactionState::TRANSACTION_FINISHED;
+		try {
+			con.Execute("END TRANSACTION;");
+		} catch (std::exception &ex) {
+			// Teradata rolls back a transaction that fails to commit, clean up after it all the same
+			RunCleanup();
+			throw;
+		}
+	}
+	RunCleanup();
 }
 
 void TeradataTransaction::Rollback() {
-	con.Execute("ABORT;");
+	lock_guard<mutex> guard(transaction_lock);
+	if (transaction_state == TeradataTransactionState::TRANSACTION_STARTED) {
+		transaction_state = TeradataTransactionState::TRANSACTION_FINISHED;
+		try {
+			con.Execute("ABORT;");
+		} catch (std::exception &ex) {
+			RunCleanup();
+			throw;
+		}
+	}
+	RunCleanup();
 }
 
 } // namespace duckdb
\ No newline at end of file
@@ -9,22 +9,38 @@
 #pragma once
 
 #include "duckdb/transaction/transaction.hpp"
+#include "duckdb/common/mutex.hpp"
 
 namespace duckdb {
 
 class TeradataCatalog;
 class TeradataConnection;
 
+enum class TeradataTransactionState { TRANSACTION_NOT_YET_STARTED, TRANSACTION_STARTED, TRANSACTION_FINISHED };
+
 class TeradataTransaction final : public Transaction {
 public:
 	TeradataTransaction(TeradataCatalog &catalog, TransactionManager &manager, ClientContext &context);
 	~TeradataTransaction() override;
 
-	TeradataConnection &GetConnection() const {
+	// Get the connection to modify Teradata with, starting the remote transaction if it has not been started yet
+	TeradataConnection &GetConnection();
+
+	// Get the connection to only read from Teradata with. Until an auto-commit transaction has written anything, each
+	// statement runs in its own implicit Teradata transaction, saving the round trips to begin and end an explicit one.
+	TeradataConnection &GetConnectionWithoutTransaction() const {
 		return con;
 	}
 
-	void Start();
+	// Whether the remote transaction has been started, i.e. whether this is an explicit transaction or it has written
+	// to Teradata
+	bool HasStarted();
+
+	// Execute a statement once the transaction has ended, e.g. to drop a volatile table used by this transaction.
+	// Teradata only allows DDL as the last statement of a transaction, so it can not be executed within it.
+	void AddCleanup(string sql);
+
+	void Start(ClientContext &context);
 	void Commit();
 	void Rollback();
 
@@ -33,6 +49,14 @@ public:
 private:
 	// TODO: This shouldnt be passed like this
 	TeradataConnection &con;
+
+	mutex transaction_lock;
+	TeradataTransactionState transaction_state;
+
+	// Statements to execute once the transaction has ended
+	vector<string> cleanup_statements;
+
+	void RunCleanup();
 };
 
 } // namespace duckdb
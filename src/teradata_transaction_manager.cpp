@@ -10,7 +10,7 @@ TeradataTransactionManager::TeradataTransactionManager(AttachedDatabase &db, Ter
 Transaction &TeradataTransactionManager::StartTransaction(ClientContext &context) {
 	auto transaction = make_uniq<TeradataTransaction>(teradata_catalog, *this, context);
 
-	transaction->Start();
+	transaction->Start(context);
 
 	auto &result = *transaction;
 	lock_guard<mutex> l(transaction_lock);